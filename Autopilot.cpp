@@ -0,0 +1,129 @@
+#include "Autopilot.h"
+
+namespace
+{
+    const SnakeDirection searchDirections[4]{ MOVING_UP, MOVING_DOWN, MOVING_LEFT, MOVING_RIGHT };
+
+    //Starts a new search, only when the stamp wraps do the marks have to be cleared
+    std::uint32_t nextSearchStamp(Autopilot& autopilot)
+    {
+        if (++autopilot.searchStamp == 0)
+        {
+            autopilot.visited.assign(autopilot.visited.size(), 0);
+            autopilot.searchStamp = 1;
+        }
+        return autopilot.searchStamp;
+    }
+
+    //A full length snake's tail moves off its cell before the head arrives anywhere, so it does not block
+    bool isCellBlocked(const GridWorld& world, std::uint32_t cell)
+    {
+        if (!world.bodyCells.test(cell))
+            return false;
+        return !(cell == world.snake.body.back() && world.snake.body.size() >= world.snake.length);
+    }
+
+    //Calls visit(neighbour, direction) for each on-board neighbour of cell, the row and column are worked out once
+    //per cell rather than once per neighbour as getNeighbourCell would
+    template <typename Visit>
+    void forEachNeighbour(const GridWorld& world, std::uint32_t cell, Visit&& visit)
+    {
+        std::uint32_t columns{ static_cast<std::uint32_t>(world.columns) };
+        std::uint32_t row{ cell / columns };
+        std::uint32_t column{ cell - (row * columns) };
+        if (row > 0)
+            visit(cell - columns, MOVING_UP);
+        if (row + 1 < static_cast<std::uint32_t>(world.rows))
+            visit(cell + columns, MOVING_DOWN);
+        if (column + 1 < columns)
+            visit(cell + 1, MOVING_LEFT);
+        if (column > 0)
+            visit(cell - 1, MOVING_RIGHT);
+    }
+}
+
+void resizeAutopilot(Autopilot& autopilot, const GridWorld& world)
+{
+    std::size_t cellCount{ world.bodyCells.size() };
+    autopilot.frontier.assign(cellCount, 0);
+    autopilot.visited.assign(cellCount, 0);
+    autopilot.firstMove.assign(cellCount, 0);
+    autopilot.searchStamp = 0;
+}
+
+SnakeDirection planAutopilotMove(Autopilot& autopilot, const GridWorld& world)
+{
+    if (autopilot.visited.size() != world.bodyCells.size())
+        resizeAutopilot(autopilot, world);
+    ++autopilot.plans;
+
+    std::uint32_t stamp{ nextSearchStamp(autopilot) };
+    std::uint32_t headCell{ world.snake.body.front() };
+    autopilot.visited[headCell] = stamp;
+
+    //Every cell is queued at most once, so the frontier never wraps
+    std::size_t begin{ 0 };
+    std::size_t end{ 0 };
+    autopilot.frontier[end++] = headCell;
+    std::uint32_t foodCell{ noGridCell };
+    while (begin < end && foodCell == noGridCell)
+    {
+        std::uint32_t cell{ autopilot.frontier[begin++] };
+        forEachNeighbour(world, cell, [&](std::uint32_t neighbour, SnakeDirection direction)
+        {
+            if (autopilot.visited[neighbour] == stamp || isCellBlocked(world, neighbour))
+                return;
+
+            autopilot.visited[neighbour] = stamp;
+            autopilot.firstMove[neighbour] = (cell == headCell) ? static_cast<std::uint8_t>(direction) : autopilot.firstMove[cell];
+            if (foodCell == noGridCell && world.foodCells.test(neighbour))
+                foodCell = neighbour;
+            autopilot.frontier[end++] = neighbour;
+        });
+    }
+    if (foodCell != noGridCell)
+        return static_cast<SnakeDirection>(autopilot.firstMove[foodCell]);
+
+    //No food in reach, stay alive as long as possible by heading for the most room, a body's length of it is plenty
+    ++autopilot.fallbackPlans;
+    SnakeDirection bestDirection{ world.snake.heading };
+    std::uint32_t bestRoom{ 0 };
+    std::uint32_t roomLimit{ static_cast<std::uint32_t>(world.snake.body.size()) + 1 };
+    for (SnakeDirection direction : searchDirections)
+    {
+        std::uint32_t neighbour{ getNeighbourCell(world, headCell, direction) };
+        if (neighbour == noGridCell || isCellBlocked(world, neighbour))
+            continue;
+
+        std::uint32_t room{ countReachableCells(autopilot, world, neighbour, roomLimit) };
+        if (room > bestRoom)
+        {
+            bestRoom = room;
+            bestDirection = direction;
+        }
+    }
+    return bestDirection;
+}
+
+std::uint32_t countReachableCells(Autopilot& autopilot, const GridWorld& world, std::uint32_t start, std::uint32_t limit)
+{
+    if (autopilot.visited.size() != world.bodyCells.size())
+        resizeAutopilot(autopilot, world);
+
+    std::uint32_t stamp{ nextSearchStamp(autopilot) };
+    autopilot.visited[start] = stamp;
+    std::size_t begin{ 0 };
+    std::size_t end{ 0 };
+    autopilot.frontier[end++] = start;
+    while (begin < end && end < limit)
+    {
+        forEachNeighbour(world, autopilot.frontier[begin++], [&](std::uint32_t neighbour, SnakeDirection)
+        {
+            if (autopilot.visited[neighbour] == stamp || isCellBlocked(world, neighbour))
+                return;
+            autopilot.visited[neighbour] = stamp;
+            autopilot.frontier[end++] = neighbour;
+        });
+    }
+    return static_cast<std::uint32_t>(end < limit ? end : limit);
+}
@@ -0,0 +1,33 @@
+//Lets a grid mode snake play itself: a breadth-first search from the head to the nearest food, with every
+//buffer it needs allocated once for the board so planning a move never touches the heap
+
+#ifndef AUTOPILOT_H
+#define AUTOPILOT_H
+
+#include <vector>
+#include <cstdint>
+
+#include "GridWorld.h"
+
+struct Autopilot
+{
+    std::vector<std::uint32_t> frontier{}; //Ring of cells waiting to be expanded, one slot per cell is always enough
+    std::vector<std::uint32_t> visited{}; //Stamp of the search that last reached each cell, so nothing is cleared between searches
+    std::vector<std::uint8_t> firstMove{}; //Direction of the first step on the path to each reached cell
+    std::uint32_t searchStamp{ 0 };
+
+    std::uint64_t plans{ 0 };
+    std::uint64_t fallbackPlans{ 0 }; //Plans that could not reach any food and headed for the most open space instead
+};
+
+//Sizes the buffers for world's board, planAutopilotMove does this itself when the board changes
+void resizeAutopilot(Autopilot& autopilot, const GridWorld& world);
+
+//Direction for the snake's next move: towards the nearest reachable food, or when none can be reached, onto
+//the neighbouring cell with the most room behind it. Keeps the current heading when every neighbour is blocked
+SnakeDirection planAutopilotMove(Autopilot& autopilot, const GridWorld& world);
+
+//Cells reachable from start without crossing the body, counting stops once limit is reached
+std::uint32_t countReachableCells(Autopilot& autopilot, const GridWorld& world, std::uint32_t start, std::uint32_t limit);
+
+#endif
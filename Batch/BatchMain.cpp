@@ -0,0 +1,121 @@
+//Steps many independent headless games across all cores and reports aggregate throughput
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "../SnakeWorld.h"
+#include "../GameClock.h"
+#include "ThreadPool.h"
+
+struct BatchResult
+{
+    std::uint64_t ticks{ 0 };
+    float length{ 0.0f };
+};
+
+//Stand-in policy: turns at random now and then, and steers back toward the middle when about to leave the platform
+SnakeDirection choosePolicyDirection(Snake& snake, GameRng& policyGen)
+{
+    const float wallMargin{ 0.3f };
+    SnakeSegment& head{ snake.snakeBody[0] };
+    float limit{ (platformScale * 0.5f) - wallMargin };
+    float x{ head.frontCoord.first - platformCenterX };
+    float z{ head.frontCoord.second - platformCenterZ };
+
+    bool nearWall{ (head.direction == MOVING_UP && x < -limit) || (head.direction == MOVING_DOWN && x > limit)
+        || (head.direction == MOVING_LEFT && z > limit) || (head.direction == MOVING_RIGHT && z < -limit) };
+    if (nearWall)
+    {
+        if (head.direction == MOVING_UP || head.direction == MOVING_DOWN)
+            return (z > 0.0f) ? MOVING_RIGHT : MOVING_LEFT;
+        return (x > 0.0f) ? MOVING_UP : MOVING_DOWN;
+    }
+
+    if (policyGen.next() % 32 == 0)
+        return static_cast<SnakeDirection>(policyGen.next() % 4);
+    return snake.currentDirection;
+}
+
+BatchResult runGame(std::uint64_t seed, RngEngine engine, std::uint64_t maxTicks, float tickSeconds)
+{
+    SnakeWorld world{ seed, engine };
+    GameRng policyGen{ ~seed, RNG_XOSHIRO };
+
+    BatchResult result{};
+    while (!world.gameOver && result.ticks < maxTicks)
+    {
+        world.snake.currentDirection = choosePolicyDirection(world.snake, policyGen);
+        world.step(tickSeconds);
+        ++result.ticks;
+    }
+    result.length = world.snake.length;
+    return result;
+}
+
+int main(int argc, char* argv[])
+{
+    std::size_t games{ 10000 };
+    unsigned int threads{ std::thread::hardware_concurrency() };
+    std::uint64_t baseSeed{ 1 };
+    std::uint64_t maxTicks{ 100000 };
+    RngEngine rngEngine{ RNG_XOSHIRO };
+    for (int i{ 1 }; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--games") == 0 && i + 1 < argc)
+            games = std::strtoull(argv[++i], NULL, 10);
+        else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            threads = static_cast<unsigned int>(std::strtoul(argv[++i], NULL, 10));
+        else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            baseSeed = std::strtoull(argv[++i], NULL, 10);
+        else if (std::strcmp(argv[i], "--max-ticks") == 0 && i + 1 < argc)
+            maxTicks = std::strtoull(argv[++i], NULL, 10);
+        else if (std::strcmp(argv[i], "--rng") == 0 && i + 1 < argc)
+        {
+            if (!parseRngEngine(argv[++i], rngEngine))
+            {
+                std::cout << "--rng must be minstd or xoshiro" << std::endl;
+                return -1;
+            }
+        }
+    }
+
+    const float tickSeconds{ static_cast<float>(1.0 / defaultTicksPerSecond) };
+    std::vector<BatchResult> results(games);
+
+    ThreadPool pool{ threads };
+    auto start{ std::chrono::steady_clock::now() };
+    //Game i always runs on seed baseSeed + i, whichever worker ends up with it
+    for (std::size_t game{ 0 }; game < games; game++)
+    {
+        pool.submit([&results, game, baseSeed, rngEngine, maxTicks, tickSeconds]()
+        {
+            results[game] = runGame(baseSeed + game, rngEngine, maxTicks, tickSeconds);
+        });
+    }
+    pool.wait();
+    double seconds{ std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() };
+
+    std::uint64_t totalTicks{ 0 };
+    double totalLength{ 0.0 };
+    for (auto& result : results)
+    {
+        totalTicks += result.ticks;
+        totalLength += result.length;
+    }
+
+    std::cout << "Games:       " << games << " on " << pool.getThreadCount() << " threads" << std::endl;
+    std::cout << "Wall time:   " << seconds << " s" << std::endl;
+    std::cout << "Games/sec:   " << (games / seconds) << std::endl;
+    std::cout << "Ticks/sec:   " << (totalTicks / seconds) << std::endl;
+    if (games > 0)
+    {
+        std::cout << "Mean ticks:  " << (static_cast<double>(totalTicks) / games) << std::endl;
+        std::cout << "Mean length: " << (totalLength / games) << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(unsigned int threadCount)
+{
+    if (threadCount == 0)
+        threadCount = 1;
+
+    for (unsigned int i{ 0 }; i < threadCount; i++)
+        queues.push_back(std::make_unique<WorkQueue>());
+    for (unsigned int i{ 0 }; i < threadCount; i++)
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock{ stateMutex };
+        stopping = true;
+    }
+    workAvailable.notify_all();
+    for (auto& worker : workers)
+        worker.join();
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+    unsigned int index{ nextQueue.fetch_add(1) % static_cast<unsigned int>(queues.size()) };
+    {
+        std::lock_guard<std::mutex> lock{ queues[index]->mutex };
+        queues[index]->tasks.push_back(std::move(task));
+    }
+    ++pendingTasks;
+    ++queuedTasks;
+
+    //Taking the state lock orders this notify after any worker's predicate check, so the wakeup cannot be lost
+    {
+        std::lock_guard<std::mutex> lock{ stateMutex };
+    }
+    workAvailable.notify_one();
+}
+
+void ThreadPool::wait()
+{
+    std::unique_lock<std::mutex> lock{ stateMutex };
+    allDone.wait(lock, [this]() { return pendingTasks.load() == 0; });
+}
+
+//Owners take from the back of their own queue, newest first, while it is still warm in cache
+bool ThreadPool::popLocal(unsigned int index, std::function<void()>& task)
+{
+    WorkQueue& queue{ *queues[index] };
+    std::lock_guard<std::mutex> lock{ queue.mutex };
+    if (queue.tasks.empty())
+        return false;
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+}
+
+//Thieves take from the front of the other queues, the oldest work, to keep contention with the owner low
+bool ThreadPool::steal(unsigned int thief, std::function<void()>& task)
+{
+    unsigned int queueCount{ static_cast<unsigned int>(queues.size()) };
+    for (unsigned int offset{ 1 }; offset < queueCount; offset++)
+    {
+        WorkQueue& queue{ *queues[(thief + offset) % queueCount] };
+        std::lock_guard<std::mutex> lock{ queue.mutex };
+        if (!queue.tasks.empty())
+        {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(unsigned int index)
+{
+    while (true)
+    {
+        std::function<void()> task{};
+        if (popLocal(index, task) || steal(index, task))
+        {
+            --queuedTasks;
+            task();
+            if (--pendingTasks == 0)
+            {
+                std::lock_guard<std::mutex> lock{ stateMutex };
+                allDone.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock{ stateMutex };
+        workAvailable.wait(lock, [this]() { return stopping || queuedTasks.load() > 0; });
+        if (stopping && queuedTasks.load() == 0)
+            return;
+    }
+}
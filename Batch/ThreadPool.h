@@ -0,0 +1,56 @@
+//Work-stealing thread pool, each worker owns a queue and steals from the others when its own runs dry
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool
+{
+public:
+    explicit ThreadPool(unsigned int threadCount);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    //Tasks are dealt round-robin onto the worker queues
+    void submit(std::function<void()> task);
+
+    //Blocks until every submitted task has finished
+    void wait();
+
+    unsigned int getThreadCount() const { return static_cast<unsigned int>(workers.size()); }
+
+private:
+    struct WorkQueue
+    {
+        std::mutex mutex{};
+        std::deque<std::function<void()>> tasks{};
+    };
+
+    bool popLocal(unsigned int index, std::function<void()>& task);
+    bool steal(unsigned int thief, std::function<void()>& task);
+    void workerLoop(unsigned int index);
+
+    std::vector<std::unique_ptr<WorkQueue>> queues{};
+    std::vector<std::thread> workers{};
+
+    std::mutex stateMutex{};
+    std::condition_variable workAvailable{};
+    std::condition_variable allDone{};
+    std::atomic<std::size_t> queuedTasks{ 0 };  //Sitting in a queue
+    std::atomic<std::size_t> pendingTasks{ 0 }; //Submitted and not yet finished
+    std::atomic<unsigned int> nextQueue{ 0 };
+    bool stopping{ false };
+};
+
+#endif
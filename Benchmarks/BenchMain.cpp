@@ -0,0 +1,128 @@
+//Runs every registered benchmark, or those whose name contains --filter, and optionally writes the results as JSON
+//  SnakeBench [--filter TEXT] [--min-time MS] [--json FILE]
+
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+
+#include "Benchmark.h"
+
+struct BenchResult
+{
+    std::string name{};
+    BenchArgs args{};
+    std::size_t iterations{ 0 };
+    double nanoseconds{ 0.0 };
+};
+
+static std::string getRunName(const BenchCase& benchCase, const BenchArgs& args)
+{
+    std::string name{ benchCase.name };
+    if (!benchCase.segmentCounts.empty())
+        name += "/" + std::to_string(args.segments);
+    if (!benchCase.foodCounts.empty())
+        name += "/" + std::to_string(args.food);
+    return name;
+}
+
+//Grows the iteration count until one run takes at least minNanoseconds, the last run is the one reported
+static BenchResult runBenchmark(const BenchCase& benchCase, const BenchArgs& args, double minNanoseconds)
+{
+    const std::size_t maxIterations{ 1000000000 };
+    BenchResult result{ getRunName(benchCase, args), args };
+    std::size_t iterations{ 1 };
+    while (true)
+    {
+        result.iterations = iterations;
+        result.nanoseconds = benchCase.function(args, iterations);
+        double totalNanoseconds{ result.nanoseconds * static_cast<double>(iterations) };
+        if (totalNanoseconds >= minNanoseconds || iterations >= maxIterations)
+            break;
+
+        double multiplier{ totalNanoseconds > 0.0 ? 1.4 * minNanoseconds / totalNanoseconds : 10.0 };
+        multiplier = multiplier < 10.0 ? multiplier : 10.0;
+        std::size_t next{ static_cast<std::size_t>(static_cast<double>(iterations) * multiplier) };
+        iterations = next > iterations ? next : iterations + 1;
+        iterations = iterations < maxIterations ? iterations : maxIterations;
+    }
+    return result;
+}
+
+static bool writeJson(const char* path, const std::vector<BenchResult>& results, double minTimeMs)
+{
+    std::ofstream file{ path };
+    if (!file)
+        return false;
+
+    char date[32]{};
+    std::time_t now{ std::time(NULL) };
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    file << "{\n  \"context\": {\n";
+    file << "    \"date\": \"" << date << "\",\n";
+    file << "    \"collision_kernel\": \"" << getCollisionKernelName() << "\",\n";
+    file << "    \"min_time_ms\": " << minTimeMs << "\n  },\n";
+    file << "  \"benchmarks\": [\n";
+    for (std::size_t i{ 0 }; i < results.size(); i++)
+    {
+        const BenchResult& result{ results[i] };
+        file << "    { \"name\": \"" << result.name << "\", \"segments\": " << result.args.segments << ", \"food\": " << result.args.food
+            << ", \"iterations\": " << result.iterations << ", \"ns_per_op\": " << result.nanoseconds << " }"
+            << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    file << "  ]\n}\n";
+    return static_cast<bool>(file);
+}
+
+int main(int argc, char* argv[])
+{
+    const char* filter{ NULL };
+    const char* jsonPath{ NULL };
+    double minTimeMs{ 50.0 };
+    for (int i{ 1 }; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+            filter = argv[++i];
+        else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+            jsonPath = argv[++i];
+        else if (std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc)
+            minTimeMs = std::atof(argv[++i]);
+    }
+
+    BenchRegistry registry{};
+    registerRingBufferBenchmarks(registry);
+    registerCollisionBenchmarks(registry);
+    registerSimdCollisionBenchmarks(registry);
+    registerGameLogicBenchmarks(registry);
+    registerGridBenchmarks(registry);
+    registerEnvBenchmarks(registry);
+
+    std::printf("collision kernel: %s\n", getCollisionKernelName());
+    std::printf("%-40s %12s %14s\n", "benchmark", "iterations", "time/op");
+    std::vector<BenchResult> results{};
+    for (auto& benchCase : registry)
+    {
+        std::vector<std::size_t> segmentCounts{ benchCase.segmentCounts.empty() ? std::vector<std::size_t>{ 0 } : benchCase.segmentCounts };
+        std::vector<std::size_t> foodCounts{ benchCase.foodCounts.empty() ? std::vector<std::size_t>{ 0 } : benchCase.foodCounts };
+        for (std::size_t segments : segmentCounts)
+        {
+            for (std::size_t food : foodCounts)
+            {
+                BenchArgs args{ segments, food };
+                if (filter != NULL && getRunName(benchCase, args).find(filter) == std::string::npos)
+                    continue;
+
+                results.push_back(runBenchmark(benchCase, args, minTimeMs * 1.0e6));
+                std::printf("%-40s %12zu %14.2f ns\n", results.back().name.c_str(), results.back().iterations, results.back().nanoseconds);
+            }
+        }
+    }
+
+    if (jsonPath != NULL && !writeJson(jsonPath, results, minTimeMs))
+    {
+        std::printf("Failed to write %s\n", jsonPath);
+        return -1;
+    }
+    return 0;
+}
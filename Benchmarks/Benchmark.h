@@ -0,0 +1,180 @@
+//Benchmark registry and timing helpers shared by the benchmark executable
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../SnakeWorld.h"
+
+//One point in a benchmark's parameter space, unused dimensions stay 0
+struct BenchArgs
+{
+    std::size_t segments{ 0 };
+    std::size_t food{ 0 };
+};
+
+//Runs the benchmark for exactly iterations operations and returns the average cost of one in nanoseconds.
+//Setup happens inside, before the timed part, so the runner can call it again with a larger count
+using BenchFunction = std::function<double(const BenchArgs& args, std::size_t iterations)>;
+
+//A benchmark is run once for every segments x food combination, an empty list leaves that dimension out of the name
+struct BenchCase
+{
+    std::string name{};
+    std::vector<std::size_t> segmentCounts{};
+    std::vector<std::size_t> foodCounts{};
+    BenchFunction function{};
+};
+
+using BenchRegistry = std::vector<BenchCase>;
+
+void registerRingBufferBenchmarks(BenchRegistry& registry);
+void registerCollisionBenchmarks(BenchRegistry& registry);
+void registerSimdCollisionBenchmarks(BenchRegistry& registry);
+void registerGameLogicBenchmarks(BenchRegistry& registry);
+void registerGridBenchmarks(BenchRegistry& registry);
+void registerEnvBenchmarks(BenchRegistry& registry);
+
+inline void addBenchmark(BenchRegistry& registry, const std::string& name, std::vector<std::size_t> segmentCounts,
+    std::vector<std::size_t> foodCounts, BenchFunction function)
+{
+    registry.push_back(BenchCase{ name, std::move(segmentCounts), std::move(foodCounts), std::move(function) });
+}
+
+//first, first * multiplier, ... up to and including last
+inline std::vector<std::size_t> benchRange(std::size_t first, std::size_t last, std::size_t multiplier)
+{
+    std::vector<std::size_t> values{};
+    for (std::size_t value{ first }; value <= last; value *= multiplier)
+        values.push_back(value);
+    return values;
+}
+
+//Stores a result where the optimiser has to assume it is read, so the work producing it cannot be dropped
+template <typename T>
+struct BenchSink
+{
+    static volatile T value;
+};
+
+template <typename T>
+volatile T BenchSink<T>::value{};
+
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+    BenchSink<T>::value = value;
+}
+
+//Calls function iterations times and returns the average cost of one call in nanoseconds
+template <typename Function>
+double measureNanoseconds(std::size_t iterations, Function&& function)
+{
+    auto start{ std::chrono::steady_clock::now() };
+    for (std::size_t i{ 0 }; i < iterations; i++)
+        function();
+    auto end{ std::chrono::steady_clock::now() };
+    return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(iterations);
+}
+
+//For operations that change what they work on: restore() runs untimed before every batchSize calls to function,
+//so each batch starts from the same state however many iterations are asked for
+template <typename Restore, typename Function>
+double measureBatchedNanoseconds(std::size_t iterations, std::size_t batchSize, Restore&& restore, Function&& function)
+{
+    double totalNanoseconds{ 0.0 };
+    for (std::size_t done{ 0 }; done < iterations; done += batchSize)
+    {
+        std::size_t batch{ iterations - done < batchSize ? iterations - done : batchSize };
+        restore();
+        auto start{ std::chrono::steady_clock::now() };
+        for (std::size_t i{ 0 }; i < batch; i++)
+            function();
+        auto end{ std::chrono::steady_clock::now() };
+        totalNanoseconds += std::chrono::duration<double, std::nano>(end - start).count();
+    }
+    return totalNanoseconds / static_cast<double>(iterations);
+}
+
+//Bounds of a benchmark board, used to size the broad-phase grids
+struct BenchBoard
+{
+    float minX{};
+    float minZ{};
+    float extentX{};
+    float extentZ{};
+};
+
+//Builds a non self-intersecting snake of the given segment count, laid out as a roughly square serpentine
+//of rows along Z joined by short MOVING_DOWN segments, so long bodies still fit a compact board.
+//The snake's grid is resized to cover it and the board is returned
+inline BenchBoard buildSerpentineSnake(Snake& snake, std::size_t segments)
+{
+    const float segmentLength{ 0.5f };
+    std::size_t runSegments{ static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(segments)))) };
+
+    snake = Snake{};
+    std::pair<float, float> point{ 0.0f, 0.0f };
+    SnakeDirection rowDirection{ MOVING_LEFT };
+    std::size_t runCount{ 0 };
+    float minZ{ 0.0f };
+    float maxZ{ 0.0f };
+    for (std::size_t i{ 0 }; i < segments; i++)
+    {
+        SnakeSegment segment{};
+        segment.backCoord = point;
+        if (runCount == runSegments)
+        {
+            segment.direction = MOVING_DOWN;
+            point.first += segmentLength;
+            rowDirection = (rowDirection == MOVING_LEFT) ? MOVING_RIGHT : MOVING_LEFT;
+            runCount = 0;
+        }
+        else
+        {
+            segment.direction = rowDirection;
+            point.second += (rowDirection == MOVING_LEFT) ? segmentLength : -segmentLength;
+            ++runCount;
+        }
+        segment.frontCoord = point;
+        snake.snakeBody.push_front(segment);
+        minZ = std::fmin(minZ, point.second);
+        maxZ = std::fmax(maxZ, point.second);
+    }
+    snake.headSerial = static_cast<std::uint32_t>(segments);
+    snake.currentDirection = snake.snakeBody[0].direction;
+    snake.length = static_cast<float>(segments) * segmentLength;
+    snake.bodyLength = snake.length;
+
+    BenchBoard board{ -snakeRadius, minZ - snakeRadius, point.first + (2 * snakeRadius), (maxZ - minZ) + (2 * snakeRadius) };
+    snake.bodyGrid.reset(board.minX, board.minZ, board.extentX, board.extentZ, gridCellSize);
+    rebuildBodyIndex(snake);
+    return board;
+}
+
+//Scatters count food pieces over the board, skipping anything the head already touches so nothing gets eaten
+//mid-run. foodGrid is sized to the board
+inline void scatterBenchFood(Snake& snake, const BenchBoard& board, std::size_t count, std::vector<std::pair<float, float>>& foodContainer, SpatialGrid& foodGrid)
+{
+    foodContainer.clear();
+    foodGrid.reset(board.minX, board.minZ, board.extentX, board.extentZ, gridCellSize);
+    std::minstd_rand randomGen{ 1 };
+    std::uniform_real_distribution<float> xDistribution{ board.minX, board.minX + board.extentX };
+    std::uniform_real_distribution<float> zDistribution{ board.minZ, board.minZ + board.extentZ };
+    while (foodContainer.size() < count)
+    {
+        std::pair<float, float> foodCoords{ xDistribution(randomGen), zDistribution(randomGen) };
+        if (!checkFoodCollision(snake.snakeBody[0], foodCoords))
+            addFoodPiece(foodContainer, foodGrid, foodCoords);
+    }
+}
+
+#endif
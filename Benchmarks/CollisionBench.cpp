@@ -0,0 +1,56 @@
+//handleCollisions through the broad-phase grids vs testing the head against every segment and food piece
+
+#include <vector>
+#include <random>
+
+#include "Benchmark.h"
+
+namespace
+{
+    //The pre-grid handleCollisions loops, kept here as the baseline
+    bool handleCollisionsLinear(Snake& snake, std::vector<std::pair<float, float>>& foodContainer)
+    {
+        bool collided{ false };
+        for (std::size_t i{ 2 }; i < snake.snakeBody.size(); i++)
+        {
+            if (checkCollision(snake.snakeBody[0], snake.snakeBody[i]))
+                collided = true;
+        }
+        for (std::size_t i{ 0 }; i < foodContainer.size(); i++)
+        {
+            if (checkFoodCollision(snake.snakeBody[0], foodContainer[i]))
+                return true;
+        }
+        return collided;
+    }
+}
+
+void registerCollisionBenchmarks(BenchRegistry& registry)
+{
+    std::vector<std::size_t> segmentCounts{ benchRange(100, 10000, 10) };
+    std::vector<std::size_t> foodCounts{ 100, 10000 };
+
+    addBenchmark(registry, "collisions/grid", segmentCounts, foodCounts, [](const BenchArgs& args, std::size_t iterations)
+    {
+        Snake snake{};
+        std::vector<std::pair<float, float>> foodContainer{};
+        SpatialGrid foodGrid{};
+        scatterBenchFood(snake, buildSerpentineSnake(snake, args.segments), args.food, foodContainer, foodGrid);
+        return measureNanoseconds(iterations, [&]()
+        {
+            doNotOptimize(handleCollisions(snake, foodContainer, foodGrid));
+        });
+    });
+
+    addBenchmark(registry, "collisions/linear", segmentCounts, foodCounts, [](const BenchArgs& args, std::size_t iterations)
+    {
+        Snake snake{};
+        std::vector<std::pair<float, float>> foodContainer{};
+        SpatialGrid foodGrid{};
+        scatterBenchFood(snake, buildSerpentineSnake(snake, args.segments), args.food, foodContainer, foodGrid);
+        return measureNanoseconds(iterations, [&]()
+        {
+            doNotOptimize(handleCollisionsLinear(snake, foodContainer));
+        });
+    });
+}
@@ -0,0 +1,94 @@
+//Training environment steps under random actions, with and without the observation buffers bound, one game at a
+//time and through VecEnv. Episodes end quickly under random play, so the resets that follow are part of the cost,
+//as they are for a trainer
+
+#include <vector>
+
+#include "Benchmark.h"
+#include "../SnakeEnv.h"
+#include "../VecEnv.h"
+
+namespace
+{
+    double measureEnvSteps(std::size_t foodCount, bool observed, std::size_t iterations)
+    {
+        EnvConfig config{};
+        config.foodCount = static_cast<std::uint32_t>(foodCount);
+        SnakeEnv env{ config };
+        std::vector<std::uint8_t> board(static_cast<std::size_t>(config.columns) * static_cast<std::size_t>(config.rows));
+        std::vector<std::int32_t> food(2 * foodCount);
+        std::int32_t head[2]{};
+        if (observed)
+            env.bindObservation(EnvObservation{ board.data(), head, food.data(), static_cast<std::uint32_t>(foodCount) });
+
+        std::vector<int> actions(4096);
+        std::minstd_rand randomGen{ 1 };
+        for (int& action : actions)
+            action = static_cast<int>(randomGen() % 4);
+
+        std::uint64_t episodes{ 0 };
+        env.reset(episodes);
+        std::size_t next{ 0 };
+        return measureNanoseconds(iterations, [&]()
+        {
+            if (env.step(actions[next++ & (actions.size() - 1)]).status != ENV_RUNNING)
+                env.reset(++episodes);
+        });
+    }
+
+    //Reported per game step, so it compares directly with measureEnvSteps
+    double measureVecEnvSteps(std::size_t lanes, bool observed, std::size_t iterations)
+    {
+        EnvConfig config{};
+        VecEnv env{ config, lanes };
+        std::size_t cellCount{ static_cast<std::size_t>(config.columns) * static_cast<std::size_t>(config.rows) };
+        std::vector<std::uint8_t> boards(lanes * cellCount);
+        std::vector<std::int32_t> heads(2 * lanes);
+        std::vector<std::int32_t> food(2 * lanes);
+        if (observed)
+            env.bindObservation(EnvObservation{ boards.data(), heads.data(), food.data(), 1 });
+
+        //Batches of actions taken in turn, so the games do not all move in lockstep
+        const std::size_t batches{ 16 };
+        std::vector<std::int32_t> actions(batches * lanes);
+        std::minstd_rand randomGen{ 1 };
+        for (std::int32_t& action : actions)
+            action = static_cast<std::int32_t>(randomGen() % 4);
+        std::vector<float> rewards(lanes);
+        std::vector<std::int32_t> statuses(lanes);
+
+        env.reset(0);
+        std::size_t steps{ (iterations + lanes - 1) / lanes };
+        std::size_t next{ 0 };
+        double nanoseconds{ measureNanoseconds(steps, [&]()
+        {
+            env.step(&actions[(next++ % batches) * lanes], rewards.data(), statuses.data());
+        }) };
+        doNotOptimize(statuses[0]);
+        return nanoseconds / static_cast<double>(lanes);
+    }
+}
+
+void registerEnvBenchmarks(BenchRegistry& registry)
+{
+    addBenchmark(registry, "env/step/observed", {}, { 1, 16 }, [](const BenchArgs& args, std::size_t iterations)
+    {
+        return measureEnvSteps(args.food, true, iterations);
+    });
+
+    addBenchmark(registry, "env/step/unobserved", {}, { 1, 16 }, [](const BenchArgs& args, std::size_t iterations)
+    {
+        return measureEnvSteps(args.food, false, iterations);
+    });
+
+    //The first dimension is the number of games stepped together
+    addBenchmark(registry, "env/vecstep/observed", { 1, 16, 256, 4096 }, {}, [](const BenchArgs& args, std::size_t iterations)
+    {
+        return measureVecEnvSteps(args.segments, true, iterations);
+    });
+
+    addBenchmark(registry, "env/vecstep/unobserved", { 1, 16, 256, 4096 }, {}, [](const BenchArgs& args, std::size_t iterations)
+    {
+        return measureVecEnvSteps(args.segments, false, iterations);
+    });
+}
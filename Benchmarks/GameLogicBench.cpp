@@ -0,0 +1,103 @@
+//The per-tick game logic on its own: movement, turning, length checks, collisions and food placement,
+//each across snake lengths from 1 to 100k segments and, where it matters, food counts
+
+#include <vector>
+
+#include "Benchmark.h"
+
+namespace
+{
+    //Food spread over the real platform, where addFood places it, rather than over the serpentine's board
+    void scatterPlatformFood(Snake& snake, std::size_t count, std::vector<std::pair<float, float>>& foodContainer, SpatialGrid& foodGrid)
+    {
+        scatterBenchFood(snake, BenchBoard{ gridMinX, gridMinZ, gridExtent, gridExtent }, count, foodContainer, foodGrid);
+    }
+}
+
+void registerGameLogicBenchmarks(BenchRegistry& registry)
+{
+    std::vector<std::size_t> segmentCounts{ benchRange(1, 100000, 10) };
+
+    //One tick of movement with the tail following, a batch moves the snake well under a segment per thousand calls
+    addBenchmark(registry, "handleMovement", segmentCounts, {}, [](const BenchArgs& args, std::size_t iterations)
+    {
+        const float dt{ 1.0e-5f };
+        Snake original{};
+        buildSerpentineSnake(original, args.segments);
+        Snake snake{};
+        return measureBatchedNanoseconds(iterations, 65536, [&]() { snake = original; }, [&]()
+        {
+            handleMovement(snake, true, dt);
+        });
+    });
+
+    //A turn: the new head segment from addSegment plus the tail pop that keeps the body the same size.
+    //Turning alternately left and up walks the head off diagonally, so new segments never pile into one grid cell
+    addBenchmark(registry, "addSegment", segmentCounts, {}, [](const BenchArgs& args, std::size_t iterations)
+    {
+        Snake original{};
+        buildSerpentineSnake(original, args.segments);
+        original.snakeBody[0].direction = MOVING_UP;
+        Snake snake{};
+        return measureBatchedNanoseconds(iterations, 1024, [&]() { snake = original; }, [&]()
+        {
+            snake.currentDirection = (snake.snakeBody[0].direction == MOVING_UP) ? MOVING_LEFT : MOVING_UP;
+            addSegment(snake);
+            popTailSegment(snake);
+        });
+    });
+
+    addBenchmark(registry, "getSnakeLength", segmentCounts, {}, [](const BenchArgs& args, std::size_t iterations)
+    {
+        Snake snake{};
+        buildSerpentineSnake(snake, args.segments);
+        return measureNanoseconds(iterations, [&]()
+        {
+            doNotOptimize(getSnakeLength(snake));
+        });
+    });
+
+    addBenchmark(registry, "handleCollisions", segmentCounts, { 10, 1000 }, [](const BenchArgs& args, std::size_t iterations)
+    {
+        Snake snake{};
+        std::vector<std::pair<float, float>> foodContainer{};
+        SpatialGrid foodGrid{};
+        scatterBenchFood(snake, buildSerpentineSnake(snake, args.segments), args.food, foodContainer, foodGrid);
+        return measureNanoseconds(iterations, [&]()
+        {
+            doNotOptimize(handleCollisions(snake, foodContainer, foodGrid));
+        });
+    });
+
+    //The head against every piece of food, what findFoodCollision saves by going through the food grid
+    addBenchmark(registry, "checkFoodCollision/all_food", {}, benchRange(1, 100000, 10), [](const BenchArgs& args, std::size_t iterations)
+    {
+        Snake snake{};
+        std::vector<std::pair<float, float>> foodContainer{};
+        SpatialGrid foodGrid{};
+        scatterBenchFood(snake, buildSerpentineSnake(snake, 1000), args.food, foodContainer, foodGrid);
+        return measureNanoseconds(iterations, [&]()
+        {
+            bool hit{ false };
+            for (auto& foodPiece : foodContainer)
+                hit ^= checkFoodCollision(snake.snakeBody[0], foodPiece);
+            doNotOptimize(hit);
+        });
+    });
+
+    //Placing one piece then taking it straight back off, so the board never fills up
+    addBenchmark(registry, "addFood", segmentCounts, { 0, 100 }, [](const BenchArgs& args, std::size_t iterations)
+    {
+        Snake snake{};
+        buildSerpentineSnake(snake, args.segments);
+        std::vector<std::pair<float, float>> foodContainer{};
+        SpatialGrid foodGrid{};
+        scatterPlatformFood(snake, args.food, foodContainer, foodGrid);
+        GameRng randomGen{ 1 };
+        return measureNanoseconds(iterations, [&]()
+        {
+            if (addFood(snake, foodContainer, foodGrid, randomGen))
+                removeFoodPiece(foodContainer, foodGrid, foodContainer.size() - 1);
+        });
+    });
+}
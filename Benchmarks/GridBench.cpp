@@ -0,0 +1,128 @@
+//Continuous movement against grid mode: one cell's worth of movement plus the collision checks that follow it,
+//across body lengths, and food placement on the occupancy bitsets. Grid bodies have one cell per segment
+
+#include <vector>
+
+#include "Benchmark.h"
+#include "../GridWorld.h"
+#include "../Autopilot.h"
+#include "../HamiltonianSolver.h"
+
+namespace
+{
+    //Free rows left below the serpentine, so a batch of moves heading down never reaches the edge
+    const int gridBenchRunway{ 1024 };
+
+    //Lays cells out as a serpentine filling the top rows of a columns x rows board, with the head heading down
+    //into whatever is left. The body is already at full length, so every move also pops the tail
+    void buildSerpentineGridWorld(GridWorld& world, std::size_t cells, int columns, int rows)
+    {
+        world = GridWorld{ 1, RNG_XOSHIRO, columns, rows };
+        while (!world.snake.body.empty())
+            popGridTail(world);
+
+        for (std::size_t i{ 0 }; i < cells; i++)
+        {
+            int row{ static_cast<int>(i / columns) };
+            int column{ static_cast<int>(i % columns) };
+            if (row % 2 == 1)
+                column = columns - 1 - column;
+            pushGridHead(world, static_cast<std::uint32_t>(row * columns + column));
+        }
+        world.snake.length = static_cast<std::uint32_t>(cells);
+        world.snake.currentDirection = MOVING_DOWN;
+        world.snake.heading = MOVING_DOWN;
+    }
+
+    //A square-ish serpentine with an empty runway below it
+    void buildSerpentineGridWorld(GridWorld& world, std::size_t cells)
+    {
+        int columns{ static_cast<int>(std::ceil(std::sqrt(static_cast<double>(cells)))) };
+        int filledRows{ static_cast<int>((cells + columns - 1) / columns) };
+        buildSerpentineGridWorld(world, cells, columns, filledRows + gridBenchRunway);
+    }
+
+    //One plan on a side x side board with the only food in the far corner, so the search covers most of the free cells
+    double measureAutopilotPlan(std::size_t cells, int side, std::size_t iterations)
+    {
+        GridWorld world{};
+        buildSerpentineGridWorld(world, cells, side, side);
+        addGridFoodPiece(world, static_cast<std::uint32_t>(side * side - 1));
+        Autopilot autopilot{};
+        resizeAutopilot(autopilot, world);
+        return measureNanoseconds(iterations, [&]()
+        {
+            doNotOptimize(planAutopilotMove(autopilot, world));
+        });
+    }
+}
+
+void registerGridBenchmarks(BenchRegistry& registry)
+{
+    std::vector<std::size_t> segmentCounts{ benchRange(100, 10000, 10) };
+
+    //Short batches keep the continuous head inside the serpentine's board, off it the broad-phase queries clamp to
+    //crowded edge cells and the numbers stop meaning much
+    addBenchmark(registry, "gridmode/move/continuous", segmentCounts, {}, [](const BenchArgs& args, std::size_t iterations)
+    {
+        const float dt{ gridCellSize / snakeMovespeed };
+        Snake original{};
+        std::vector<std::pair<float, float>> foodContainer{};
+        SpatialGrid foodGrid{};
+        scatterBenchFood(original, buildSerpentineSnake(original, args.segments), 0, foodContainer, foodGrid);
+        Snake snake{};
+        return measureBatchedNanoseconds(iterations, 8, [&]() { snake = original; }, [&]()
+        {
+            moveSnake(snake, dt);
+            doNotOptimize(handleCollisions(snake, foodContainer, foodGrid));
+        });
+    });
+
+    addBenchmark(registry, "gridmode/move/grid", segmentCounts, {}, [](const BenchArgs& args, std::size_t iterations)
+    {
+        GridWorld original{};
+        buildSerpentineGridWorld(original, args.segments);
+        GridWorld world{};
+        return measureBatchedNanoseconds(iterations, gridBenchRunway, [&]() { world = original; }, [&]()
+        {
+            doNotOptimize(advanceGridSnake(world));
+        });
+    });
+
+    //Placing one piece then taking it straight back off, the grid counterpart of the addFood benchmark
+    addBenchmark(registry, "gridmode/addFood/grid", segmentCounts, {}, [](const BenchArgs& args, std::size_t iterations)
+    {
+        GridWorld world{};
+        buildSerpentineGridWorld(world, args.segments);
+        return measureNanoseconds(iterations, [&]()
+        {
+            if (addGridFood(world))
+                removeGridFoodPiece(world, world.foodContainer.back());
+        });
+    });
+
+    //The autopilot's search on the default board and on one with 100 times the cells
+    addBenchmark(registry, "gridmode/autopilot/20x20", { 10, 100 }, {}, [](const BenchArgs& args, std::size_t iterations)
+    {
+        return measureAutopilotPlan(args.segments, gridBoardCells, iterations);
+    });
+
+    addBenchmark(registry, "gridmode/autopilot/200x200", benchRange(100, 10000, 10), {}, [](const BenchArgs& args, std::size_t iterations)
+    {
+        return measureAutopilotPlan(args.segments, gridBoardCells * 10, iterations);
+    });
+
+    //A solver move on the default board, from the compile-time cycle
+    addBenchmark(registry, "gridmode/hamiltonian/20x20", { 10, 100 }, {}, [](const BenchArgs& args, std::size_t iterations)
+    {
+        GridWorld world{};
+        buildSerpentineGridWorld(world, args.segments, gridBoardCells, gridBoardCells);
+        addGridFoodPiece(world, static_cast<std::uint32_t>(gridBoardCells * gridBoardCells - 1));
+        HamiltonianCycle cycle{};
+        initHamiltonianCycle(cycle, world);
+        return measureNanoseconds(iterations, [&]()
+        {
+            doNotOptimize(planHamiltonianMove(cycle, world));
+        });
+    });
+}
@@ -0,0 +1,37 @@
+//Cost of the storage half of a turn (new head in, old tail out) against body length,
+//ring buffer body vs the old vector::insert(begin()) body
+
+#include <vector>
+
+#include "Benchmark.h"
+
+void registerRingBufferBenchmarks(BenchRegistry& registry)
+{
+    std::vector<std::size_t> segmentCounts{ benchRange(16, 65536, 16) };
+
+    addBenchmark(registry, "turn/ring_buffer", segmentCounts, {}, [](const BenchArgs& args, std::size_t iterations)
+    {
+        Snake snake{};
+        buildSerpentineSnake(snake, args.segments);
+        RingBuffer<SnakeSegment> ringBody{ snake.snakeBody };
+        return measureNanoseconds(iterations, [&]()
+        {
+            SnakeSegment head{ ringBody[0] };
+            ringBody.push_front(head);
+            ringBody.pop_back();
+        });
+    });
+
+    addBenchmark(registry, "turn/vector_insert_begin", segmentCounts, {}, [](const BenchArgs& args, std::size_t iterations)
+    {
+        Snake snake{};
+        buildSerpentineSnake(snake, args.segments);
+        std::vector<SnakeSegment> vectorBody(snake.snakeBody.begin(), snake.snakeBody.end());
+        return measureNanoseconds(iterations, [&]()
+        {
+            SnakeSegment head{ vectorBody[0] };
+            vectorBody.insert(vectorBody.begin(), head);
+            vectorBody.pop_back();
+        });
+    });
+}
@@ -0,0 +1,61 @@
+//Self-collision scan of a whole body: the checkCollision/inBox loop vs the struct-of-arrays kernel, scalar and SIMD
+
+#include "Benchmark.h"
+
+namespace
+{
+    //The bench body is never wrapped in its ring, so indices 2 onward are one run of slots
+    struct ScanSetup
+    {
+        Snake snake{};
+        std::pair<float, float> corners[2]{};
+        std::size_t first{ 0 };
+        std::size_t count{ 0 };
+    };
+
+    void buildScanSetup(ScanSetup& setup, std::size_t segments)
+    {
+        buildSerpentineSnake(setup.snake, segments);
+        getLeadingCorners(setup.snake.snakeBody[0], setup.corners[0], setup.corners[1]);
+        setup.first = setup.snake.snakeBody.slotOf(2);
+        setup.count = segments - 2;
+    }
+}
+
+void registerSimdCollisionBenchmarks(BenchRegistry& registry)
+{
+    std::vector<std::size_t> segmentCounts{ benchRange(16, 4096, 4) };
+
+    addBenchmark(registry, "self_scan/checkCollision_loop", segmentCounts, {}, [](const BenchArgs& args, std::size_t iterations)
+    {
+        ScanSetup setup{};
+        buildScanSetup(setup, args.segments);
+        return measureNanoseconds(iterations, [&]()
+        {
+            bool hit{ false };
+            for (std::size_t i{ 2 }; i < setup.snake.snakeBody.size(); i++)
+                hit ^= checkCollision(setup.snake.snakeBody[0], setup.snake.snakeBody[i]);
+            doNotOptimize(hit);
+        });
+    });
+
+    addBenchmark(registry, "self_scan/soa_scalar", segmentCounts, {}, [](const BenchArgs& args, std::size_t iterations)
+    {
+        ScanSetup setup{};
+        buildScanSetup(setup, args.segments);
+        return measureNanoseconds(iterations, [&]()
+        {
+            doNotOptimize(anyBoxContainsScalar(setup.snake.bodyBounds, setup.first, setup.count, setup.corners[0], setup.corners[1]));
+        });
+    });
+
+    addBenchmark(registry, "self_scan/soa_simd", segmentCounts, {}, [](const BenchArgs& args, std::size_t iterations)
+    {
+        ScanSetup setup{};
+        buildScanSetup(setup, args.segments);
+        return measureNanoseconds(iterations, [&]()
+        {
+            doNotOptimize(anyBoxContains(setup.snake.bodyBounds, setup.first, setup.count, setup.corners[0], setup.corners[1]));
+        });
+    });
+}
@@ -0,0 +1,108 @@
+#include "CollisionKernel.h"
+
+#if defined(__AVX2__)
+#define SNAKE_KERNEL_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SNAKE_KERNEL_SSE2
+#include <emmintrin.h>
+#endif
+
+bool anyBoxContainsScalar(const SegmentBounds& bounds, std::size_t first, std::size_t count, std::pair<float, float> point1, std::pair<float, float> point2)
+{
+    for (std::size_t i{ first }; i < first + count; i++)
+    {
+        bool contains1{ (bounds.x1[i] < point1.first) && (point1.first < bounds.x2[i]) && (bounds.z1[i] < point1.second) && (point1.second < bounds.z2[i]) };
+        bool contains2{ (bounds.x1[i] < point2.first) && (point2.first < bounds.x2[i]) && (bounds.z1[i] < point2.second) && (point2.second < bounds.z2[i]) };
+        if (contains1 || contains2)
+            return true;
+    }
+    return false;
+}
+
+#if defined(SNAKE_KERNEL_AVX2)
+
+//Eight boxes per iteration, both corners tested against all eight before a single movemask
+bool anyBoxContains(const SegmentBounds& bounds, std::size_t first, std::size_t count, std::pair<float, float> point1, std::pair<float, float> point2)
+{
+    const __m256 pointX1{ _mm256_set1_ps(point1.first) };
+    const __m256 pointZ1{ _mm256_set1_ps(point1.second) };
+    const __m256 pointX2{ _mm256_set1_ps(point2.first) };
+    const __m256 pointZ2{ _mm256_set1_ps(point2.second) };
+
+    std::size_t i{ first };
+    std::size_t end{ first + count };
+    for (; i + 8 <= end; i += 8)
+    {
+        __m256 x1{ _mm256_loadu_ps(bounds.x1.data() + i) };
+        __m256 x2{ _mm256_loadu_ps(bounds.x2.data() + i) };
+        __m256 z1{ _mm256_loadu_ps(bounds.z1.data() + i) };
+        __m256 z2{ _mm256_loadu_ps(bounds.z2.data() + i) };
+
+        __m256 inside1{ _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(x1, pointX1, _CMP_LT_OQ), _mm256_cmp_ps(pointX1, x2, _CMP_LT_OQ)),
+                                      _mm256_and_ps(_mm256_cmp_ps(z1, pointZ1, _CMP_LT_OQ), _mm256_cmp_ps(pointZ1, z2, _CMP_LT_OQ))) };
+        __m256 inside2{ _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(x1, pointX2, _CMP_LT_OQ), _mm256_cmp_ps(pointX2, x2, _CMP_LT_OQ)),
+                                      _mm256_and_ps(_mm256_cmp_ps(z1, pointZ2, _CMP_LT_OQ), _mm256_cmp_ps(pointZ2, z2, _CMP_LT_OQ))) };
+        if (_mm256_movemask_ps(_mm256_or_ps(inside1, inside2)) != 0)
+            return true;
+    }
+    return anyBoxContainsScalar(bounds, i, end - i, point1, point2);
+}
+
+const char* getCollisionKernelName()
+{
+    return "avx2";
+}
+
+#elif defined(SNAKE_KERNEL_SSE2)
+
+//Two groups of four boxes per iteration so each pass still covers eight segments
+bool anyBoxContains(const SegmentBounds& bounds, std::size_t first, std::size_t count, std::pair<float, float> point1, std::pair<float, float> point2)
+{
+    const __m128 pointX1{ _mm_set1_ps(point1.first) };
+    const __m128 pointZ1{ _mm_set1_ps(point1.second) };
+    const __m128 pointX2{ _mm_set1_ps(point2.first) };
+    const __m128 pointZ2{ _mm_set1_ps(point2.second) };
+
+    std::size_t i{ first };
+    std::size_t end{ first + count };
+    for (; i + 8 <= end; i += 8)
+    {
+        __m128 hits{ _mm_setzero_ps() };
+        for (std::size_t half{ 0 }; half < 8; half += 4)
+        {
+            __m128 x1{ _mm_loadu_ps(bounds.x1.data() + i + half) };
+            __m128 x2{ _mm_loadu_ps(bounds.x2.data() + i + half) };
+            __m128 z1{ _mm_loadu_ps(bounds.z1.data() + i + half) };
+            __m128 z2{ _mm_loadu_ps(bounds.z2.data() + i + half) };
+
+            __m128 inside1{ _mm_and_ps(_mm_and_ps(_mm_cmplt_ps(x1, pointX1), _mm_cmplt_ps(pointX1, x2)),
+                                       _mm_and_ps(_mm_cmplt_ps(z1, pointZ1), _mm_cmplt_ps(pointZ1, z2))) };
+            __m128 inside2{ _mm_and_ps(_mm_and_ps(_mm_cmplt_ps(x1, pointX2), _mm_cmplt_ps(pointX2, x2)),
+                                       _mm_and_ps(_mm_cmplt_ps(z1, pointZ2), _mm_cmplt_ps(pointZ2, z2))) };
+            hits = _mm_or_ps(hits, _mm_or_ps(inside1, inside2));
+        }
+        if (_mm_movemask_ps(hits) != 0)
+            return true;
+    }
+    return anyBoxContainsScalar(bounds, i, end - i, point1, point2);
+}
+
+const char* getCollisionKernelName()
+{
+    return "sse2";
+}
+
+#else
+
+bool anyBoxContains(const SegmentBounds& bounds, std::size_t first, std::size_t count, std::pair<float, float> point1, std::pair<float, float> point2)
+{
+    return anyBoxContainsScalar(bounds, first, count, point1, point2);
+}
+
+const char* getCollisionKernelName()
+{
+    return "scalar";
+}
+
+#endif
@@ -0,0 +1,28 @@
+//Struct-of-arrays box containment kernel, AVX2 or SSE2 when the compiler targets them with a scalar fallback
+
+#ifndef COLLISION_KERNEL_H
+#define COLLISION_KERNEL_H
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+//Boxes stored one coordinate per array, slot i of each array belongs to the same box
+struct SegmentBounds
+{
+    std::vector<float> x1{};
+    std::vector<float> x2{};
+    std::vector<float> z1{};
+    std::vector<float> z2{};
+};
+
+//True if either point lies strictly inside any of the count boxes starting at first, same test as inBox
+bool anyBoxContains(const SegmentBounds& bounds, std::size_t first, std::size_t count, std::pair<float, float> point1, std::pair<float, float> point2);
+
+//Always the plain loop, kept callable on its own for benchmarking against the vector path
+bool anyBoxContainsScalar(const SegmentBounds& bounds, std::size_t first, std::size_t count, std::pair<float, float> point1, std::pair<float, float> point2);
+
+//"avx2", "sse2" or "scalar"
+const char* getCollisionKernelName();
+
+#endif
@@ -0,0 +1,152 @@
+#include "SnakeEnvApi.h"
+#include "../SnakeEnv.h"
+#include "../VecEnv.h"
+
+#include <new>
+#include <stdexcept>
+
+struct snake_env
+{
+    SnakeEnv env;
+};
+
+struct snake_vec_env
+{
+    VecEnv env;
+};
+
+//The C header mirrors these, a mismatch breaks every caller silently
+static_assert(SNAKE_ENV_CELL_FOOD == envCellFood && SNAKE_ENV_CELL_HEAD == envCellHead, "board values out of sync");
+static_assert(SNAKE_ENV_RIGHT == MOVING_RIGHT && SNAKE_ENV_UP == MOVING_UP, "actions out of sync");
+static_assert(SNAKE_ENV_TRUNCATED == ENV_TRUNCATED && SNAKE_ENV_TERMINATED == ENV_TERMINATED, "step results out of sync");
+
+uint32_t snake_env_abi_version(void)
+{
+    return SNAKE_ENV_ABI_VERSION;
+}
+
+void snake_env_default_config(snake_env_config* config)
+{
+    EnvConfig defaults{};
+    config->columns = defaults.columns;
+    config->rows = defaults.rows;
+    config->food_count = defaults.foodCount;
+    config->max_steps = defaults.maxSteps;
+    config->food_reward = defaults.foodReward;
+    config->death_reward = defaults.deathReward;
+    config->step_reward = defaults.stepReward;
+}
+
+static bool convertConfig(const snake_env_config* config, EnvConfig& envConfig)
+{
+    if (config == NULL)
+        return false;
+
+    envConfig.columns = config->columns;
+    envConfig.rows = config->rows;
+    envConfig.foodCount = config->food_count;
+    envConfig.maxSteps = config->max_steps;
+    envConfig.foodReward = config->food_reward;
+    envConfig.deathReward = config->death_reward;
+    envConfig.stepReward = config->step_reward;
+    return true;
+}
+
+//Exceptions must not cross the C boundary, an invalid board or allocation failure comes back as NULL
+snake_env* snake_env_create(const snake_env_config* config)
+{
+    EnvConfig envConfig{};
+    if (!convertConfig(config, envConfig))
+        return NULL;
+
+    try
+    {
+        return new snake_env{ SnakeEnv{ envConfig } };
+    }
+    catch (const std::invalid_argument&)
+    {
+        return NULL;
+    }
+    catch (const std::bad_alloc&)
+    {
+        return NULL;
+    }
+}
+
+void snake_env_destroy(snake_env* env)
+{
+    delete env;
+}
+
+void snake_env_bind(snake_env* env, uint8_t* board, int32_t* head, int32_t* food, uint32_t food_slots)
+{
+    EnvObservation observation{};
+    observation.board = board;
+    observation.head = head;
+    observation.food = food;
+    observation.foodSlots = (food != NULL) ? food_slots : 0;
+    env->env.bindObservation(observation);
+}
+
+void snake_env_reset(snake_env* env, uint64_t seed)
+{
+    env->env.reset(seed);
+}
+
+int32_t snake_env_step(snake_env* env, int32_t action, float* reward)
+{
+    EnvStep result{ env->env.step(action) };
+    if (reward != NULL)
+        *reward = result.reward;
+    return static_cast<int32_t>(result.status);
+}
+
+uint32_t snake_env_length(const snake_env* env)
+{
+    return static_cast<uint32_t>(env->env.getWorld().snake.body.size());
+}
+
+snake_vec_env* snake_vec_env_create(const snake_env_config* config, uint32_t lane_count)
+{
+    EnvConfig envConfig{};
+    if (!convertConfig(config, envConfig) || lane_count == 0)
+        return NULL;
+
+    try
+    {
+        return new snake_vec_env{ VecEnv{ envConfig, lane_count } };
+    }
+    catch (const std::invalid_argument&)
+    {
+        return NULL;
+    }
+    catch (const std::bad_alloc&)
+    {
+        return NULL;
+    }
+}
+
+void snake_vec_env_destroy(snake_vec_env* env)
+{
+    delete env;
+}
+
+void snake_vec_env_bind(snake_vec_env* env, uint8_t* boards, int32_t* heads, int32_t* food, uint32_t food_slots)
+{
+    EnvObservation observation{};
+    observation.board = boards;
+    observation.head = heads;
+    observation.food = food;
+    observation.foodSlots = (food != NULL) ? food_slots : 0;
+    env->env.bindObservation(observation);
+}
+
+void snake_vec_env_reset(snake_vec_env* env, uint64_t seed)
+{
+    env->env.reset(seed);
+}
+
+void snake_vec_env_step(snake_vec_env* env, const int32_t* actions, float* rewards, int32_t* results)
+{
+    env->env.step(actions, rewards, results);
+}
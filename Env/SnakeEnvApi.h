@@ -0,0 +1,95 @@
+/*C interface to SnakeEnv for trainers in other languages (ctypes, cffi, P/Invoke). Plain C types only, observations
+  go into buffers the caller allocates and binds once, and nothing is allocated between create and destroy.
+  Anything that changes a declaration here bumps SNAKE_ENV_ABI_VERSION*/
+
+#ifndef SNAKE_ENV_API_H
+#define SNAKE_ENV_API_H
+
+#include <stdint.h>
+
+#define SNAKE_ENV_ABI_VERSION 2
+
+#if defined(_WIN32)
+    #if defined(SNAKE_ENV_EXPORTS)
+        #define SNAKE_ENV_API __declspec(dllexport)
+    #else
+        #define SNAKE_ENV_API __declspec(dllimport)
+    #endif
+#else
+    #define SNAKE_ENV_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct snake_env snake_env;
+typedef struct snake_vec_env snake_vec_env;
+
+/*Fill with snake_env_default_config before changing fields*/
+typedef struct snake_env_config
+{
+    int32_t columns;
+    int32_t rows;
+    uint32_t food_count;
+    uint64_t max_steps;
+    float food_reward;
+    float death_reward;
+    float step_reward;
+} snake_env_config;
+
+/*Board cell values*/
+#define SNAKE_ENV_CELL_EMPTY 0
+#define SNAKE_ENV_CELL_BODY 1
+#define SNAKE_ENV_CELL_HEAD 2
+#define SNAKE_ENV_CELL_FOOD 3
+
+/*Actions, anything else keeps the current heading*/
+#define SNAKE_ENV_UP 0
+#define SNAKE_ENV_DOWN 1
+#define SNAKE_ENV_LEFT 2
+#define SNAKE_ENV_RIGHT 3
+
+/*Step results*/
+#define SNAKE_ENV_RUNNING 0
+#define SNAKE_ENV_TERMINATED 1
+#define SNAKE_ENV_TRUNCATED 2
+
+SNAKE_ENV_API uint32_t snake_env_abi_version(void);
+SNAKE_ENV_API void snake_env_default_config(snake_env_config* config);
+
+/*Returns NULL if the config is invalid or out of memory. Boards need at least 2 columns and 3 rows*/
+SNAKE_ENV_API snake_env* snake_env_create(const snake_env_config* config);
+SNAKE_ENV_API void snake_env_destroy(snake_env* env);
+
+/*board holds rows * columns bytes, head 2 int32s (row, column) and food 2 * food_slots int32s, -1 for unused slots.
+  Any may be NULL. The buffers must outlive the binding and are only rewritten where the state changed, so they must
+  not be modified by the caller between steps*/
+SNAKE_ENV_API void snake_env_bind(snake_env* env, uint8_t* board, int32_t* head, int32_t* food, uint32_t food_slots);
+
+SNAKE_ENV_API void snake_env_reset(snake_env* env, uint64_t seed);
+
+/*Returns one of the step results, reward may be NULL*/
+SNAKE_ENV_API int32_t snake_env_step(snake_env* env, int32_t action, float* reward);
+
+SNAKE_ENV_API uint32_t snake_env_length(const snake_env* env);
+
+/*lane_count games stepped together, each with a single piece of food (food_count is not used). Games that end are
+  restarted inside snake_vec_env_step, and their buffers then hold the new episode's first observation*/
+SNAKE_ENV_API snake_vec_env* snake_vec_env_create(const snake_env_config* config, uint32_t lane_count);
+SNAKE_ENV_API void snake_vec_env_destroy(snake_vec_env* env);
+
+/*The buffers hold one game after another, each game's part laid out as for snake_env_bind*/
+SNAKE_ENV_API void snake_vec_env_bind(snake_vec_env* env, uint8_t* boards, int32_t* heads, int32_t* food, uint32_t food_slots);
+
+/*Game i starts from seed + i*/
+SNAKE_ENV_API void snake_vec_env_reset(snake_vec_env* env, uint64_t seed);
+
+/*actions, rewards and results hold lane_count entries, results are the step results above*/
+SNAKE_ENV_API void snake_vec_env_step(snake_vec_env* env, const int32_t* actions, float* rewards, int32_t* results);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
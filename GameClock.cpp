@@ -0,0 +1,28 @@
+#include "GameClock.h"
+
+GameClock::GameClock(double ticksPerSecond)
+    : ticksPerSecond{ ticksPerSecond }, tickSeconds{ 1.0 / ticksPerSecond }
+{
+}
+
+int GameClock::advance(double frameSeconds)
+{
+    if (frameSeconds > maxFrameSeconds)
+        frameSeconds = maxFrameSeconds;
+    if (frameSeconds < 0.0)
+        frameSeconds = 0.0;
+
+    accumulator += frameSeconds;
+    int ticks{ 0 };
+    while (accumulator >= tickSeconds)
+    {
+        accumulator -= tickSeconds;
+        ++ticks;
+    }
+    return ticks;
+}
+
+float GameClock::alpha() const
+{
+    return static_cast<float>(accumulator / tickSeconds);
+}
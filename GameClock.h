@@ -0,0 +1,26 @@
+//Fixed timestep accumulator, the simulation only ever advances in whole ticks of tickSeconds
+
+#ifndef GAME_CLOCK_H
+#define GAME_CLOCK_H
+
+const double defaultTicksPerSecond{ 60.0 };
+
+//Longest stretch of real time a single frame may feed in, so a stall cannot queue up an unbounded burst of ticks
+const double maxFrameSeconds{ 0.25 };
+
+struct GameClock
+{
+    double ticksPerSecond{};
+    double tickSeconds{};
+    double accumulator{ 0.0 };
+
+    explicit GameClock(double ticksPerSecond = defaultTicksPerSecond);
+
+    //Adds a frame's worth of real time and returns how many ticks are now due
+    int advance(double frameSeconds);
+
+    //How far into the next tick the clock is, in [0, 1), used to interpolate rendering between ticks
+    float alpha() const;
+};
+
+#endif
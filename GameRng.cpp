@@ -0,0 +1,75 @@
+#include "GameRng.h"
+
+#include <cstring>
+
+namespace
+{
+    std::uint32_t rotateLeft(std::uint32_t value, int bits)
+    {
+        return (value << bits) | (value >> (32 - bits));
+    }
+
+    //Spreads one 64 bit seed over the whole xoshiro state so nearby seeds give unrelated streams
+    std::uint64_t splitMix64(std::uint64_t& seedState)
+    {
+        std::uint64_t z{ (seedState += 0x9E3779B97F4A7C15ull) };
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+}
+
+GameRng::GameRng(std::uint64_t seed, RngEngine engine)
+{
+    this->seed(seed, engine);
+}
+
+void GameRng::seed(std::uint64_t seed, RngEngine engine)
+{
+    this->engine = engine;
+    minstd.seed(static_cast<std::uint32_t>(seed));
+
+    std::uint64_t seedState{ seed };
+    std::uint64_t first{ splitMix64(seedState) };
+    std::uint64_t second{ splitMix64(seedState) };
+    state[0] = static_cast<std::uint32_t>(first);
+    state[1] = static_cast<std::uint32_t>(first >> 32);
+    state[2] = static_cast<std::uint32_t>(second);
+    state[3] = static_cast<std::uint32_t>(second >> 32);
+}
+
+std::uint32_t GameRng::next()
+{
+    if (engine == RNG_MINSTD)
+        return static_cast<std::uint32_t>(minstd());
+
+    std::uint32_t result{ rotateLeft(state[1] * 5, 7) * 9 };
+    std::uint32_t shifted{ state[1] << 9 };
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= shifted;
+    state[3] = rotateLeft(state[3], 11);
+    return result;
+}
+
+float GameRng::nextUnit()
+{
+    if (engine == RNG_MINSTD)
+        return static_cast<float>(minstd()) / static_cast<float>(std::minstd_rand::max());
+
+    //Top 24 bits fill a float mantissa exactly
+    return static_cast<float>(next() >> 8) * (1.0f / 16777215.0f);
+}
+
+bool parseRngEngine(const char* name, RngEngine& engine)
+{
+    if (std::strcmp(name, "minstd") == 0)
+        engine = RNG_MINSTD;
+    else if (std::strcmp(name, "xoshiro") == 0)
+        engine = RNG_XOSHIRO;
+    else
+        return false;
+    return true;
+}
@@ -0,0 +1,37 @@
+//Seedable random stream owned by the game state, one stream per game so runs are bit-reproducible
+
+#ifndef GAME_RNG_H
+#define GAME_RNG_H
+
+#include <cstdint>
+#include <random>
+
+enum RngEngine
+{
+    RNG_MINSTD,
+    RNG_XOSHIRO
+};
+
+class GameRng
+{
+public:
+    explicit GameRng(std::uint64_t seed = 0, RngEngine engine = RNG_XOSHIRO);
+
+    void seed(std::uint64_t seed, RngEngine engine);
+    RngEngine getEngine() const { return engine; }
+
+    std::uint32_t next();
+
+    //Uniform sample in [0, 1]
+    float nextUnit();
+
+private:
+    RngEngine engine{ RNG_XOSHIRO };
+    std::minstd_rand minstd{};
+    std::uint32_t state[4]{}; //xoshiro128** state
+};
+
+//Parses "minstd" or "xoshiro", returns false for anything else
+bool parseRngEngine(const char* name, RngEngine& engine);
+
+#endif
@@ -0,0 +1,68 @@
+#include "GpuTimer.h"
+
+const ProfileStage gpuPassStages[GPU_PASS_COUNT]{ PROFILE_GPU_PLATFORM, PROFILE_GPU_SNAKE, PROFILE_GPU_FOOD };
+
+void initGpuTimer(GpuTimer& timer)
+{
+    glGenQueries(gpuTimerFrames * GPU_PASS_COUNT, &timer.queries[0][0]);
+    timer.enabled = true;
+}
+
+void deleteGpuTimer(GpuTimer& timer)
+{
+    if (!timer.enabled)
+        return;
+    glDeleteQueries(gpuTimerFrames * GPU_PASS_COUNT, &timer.queries[0][0]);
+    timer.enabled = false;
+}
+
+//Harvests the set this frame is about to overwrite, it was issued gpuTimerFrames frames ago and is normally long finished
+void beginGpuFrame(GpuTimer& timer)
+{
+    if (!timer.enabled)
+        return;
+
+    int slot{ timer.frame % gpuTimerFrames };
+    for (int pass{ 0 }; pass < GPU_PASS_COUNT; pass++)
+    {
+        if (!timer.pending[slot][pass])
+            continue;
+        timer.pending[slot][pass] = false;
+
+        GLint available{ GL_FALSE };
+        glGetQueryObjectiv(timer.queries[slot][pass], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available == GL_FALSE)
+        {
+            timer.droppedResults++;
+            continue;
+        }
+        GLuint64 elapsed{ 0 };
+        glGetQueryObjectui64v(timer.queries[slot][pass], GL_QUERY_RESULT, &elapsed);
+        recordProfileSample(gpuPassStages[pass], static_cast<std::uint64_t>(elapsed));
+    }
+}
+
+//Only one GL_TIME_ELAPSED query can be active at a time, passes must not overlap
+void beginGpuPass(GpuTimer& timer, GpuPass pass)
+{
+    if (!timer.enabled)
+        return;
+
+    int slot{ timer.frame % gpuTimerFrames };
+    glBeginQuery(GL_TIME_ELAPSED, timer.queries[slot][pass]);
+    timer.pending[slot][pass] = true;
+}
+
+void endGpuPass(GpuTimer& timer)
+{
+    if (!timer.enabled)
+        return;
+    glEndQuery(GL_TIME_ELAPSED);
+}
+
+void endGpuFrame(GpuTimer& timer)
+{
+    if (!timer.enabled)
+        return;
+    timer.frame++;
+}
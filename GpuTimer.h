@@ -0,0 +1,38 @@
+//GL_TIME_ELAPSED queries around each render pass, results are read a few frames late so the CPU never waits on the GPU
+
+#ifndef GPU_TIMER_H
+#define GPU_TIMER_H
+
+#include <glad/glad.h>
+
+#include "Profiler.h"
+
+enum GpuPass
+{
+    GPU_PASS_PLATFORM,
+    GPU_PASS_SNAKE,
+    GPU_PASS_FOOD,
+    GPU_PASS_COUNT
+};
+
+//Each frame writes its own set of queries, a set is only read back when its turn comes round again
+const int gpuTimerFrames{ 3 };
+
+struct GpuTimer
+{
+    bool enabled{ false };
+    unsigned int queries[gpuTimerFrames][GPU_PASS_COUNT]{};
+    bool pending[gpuTimerFrames][GPU_PASS_COUNT]{};
+    int frame{ 0 };
+    unsigned long long droppedResults{ 0 }; //Results still not ready after gpuTimerFrames frames, skipped rather than waited on
+};
+
+//The timer stays disabled, and every call a no-op, unless this is called
+void initGpuTimer(GpuTimer& timer);
+void deleteGpuTimer(GpuTimer& timer);
+void beginGpuFrame(GpuTimer& timer);
+void beginGpuPass(GpuTimer& timer, GpuPass pass);
+void endGpuPass(GpuTimer& timer);
+void endGpuFrame(GpuTimer& timer);
+
+#endif
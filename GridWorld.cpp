@@ -0,0 +1,257 @@
+#include "GridWorld.h"
+#include "Profiler.h"
+
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <cassert>
+
+bool parseGameMode(const char* name, GameMode& mode)
+{
+    if (std::strcmp(name, "continuous") == 0)
+        mode = MODE_CONTINUOUS;
+    else if (std::strcmp(name, "grid") == 0)
+        mode = MODE_GRID;
+    else
+        return false;
+    return true;
+}
+
+GridWorld::GridWorld()
+    : GridWorld(static_cast<std::uint64_t>(std::chrono::system_clock::now().time_since_epoch().count()))
+{
+}
+
+GridWorld::GridWorld(std::uint64_t seed, RngEngine engine, int columns, int rows)
+    : columns{ columns }, rows{ rows }
+{
+    randomGen.seed(seed, engine);
+    reset(seed);
+}
+
+//Starts like SnakeWorld: two cells heading up from the middle of the board, growing to a length of 1
+void GridWorld::reset(std::uint64_t seed)
+{
+    std::size_t cellCount{ static_cast<std::size_t>(columns) * static_cast<std::size_t>(rows) };
+    bodyCells.resize(cellCount);
+    foodCells.resize(cellCount);
+    foodSlots.assign(cellCount, 0);
+    foodContainer.clear();
+
+    //The body keeps its storage, so restarting on a board that has been played on does not allocate
+    snake.body.clear();
+    snake.currentDirection = MOVING_UP;
+    snake.heading = MOVING_UP;
+    snake.length = static_cast<std::uint32_t>(1.0f / gridCellSize);
+    std::pair<std::uint32_t, std::uint32_t> startCells{ getGridStartCells(columns, rows) };
+    assert(startCells.second != noGridCell && "board too short for the starting body");
+    pushGridHead(*this, startCells.second);
+    pushGridHead(*this, startCells.first);
+
+    randomGen.seed(seed, randomGen.getEngine());
+    this->seed = seed;
+    stepCount = 0;
+    moveCount = 0;
+    moveProgress = 0.0f;
+    gameOver = false;
+    spawnedFood = false;
+}
+
+void GridWorld::step(float dt)
+{
+    {
+        PROFILE_SCOPE(PROFILE_FOOD);
+        spawnedFood = (stepCount % foodSpawnInterval == 0) && addGridFood(*this);
+        if (spawnedFood)
+            spawnedFoodCell = foodContainer.back();
+    }
+    ++stepCount;
+
+    //Moving and colliding are one operation here, the whole move is timed as movement
+    PROFILE_SCOPE(PROFILE_MOVE);
+    moveProgress += snakeMovespeed * dt;
+    while (moveProgress >= gridCellSize && !gameOver)
+    {
+        moveProgress -= gridCellSize;
+        advanceGridSnake(*this);
+    }
+}
+
+bool isValidGridBoard(int columns, int rows)
+{
+    if (columns < minGridColumns || rows < minGridRows)
+        return false;
+    return static_cast<long long>(columns) * static_cast<long long>(rows) <= INT_MAX;
+}
+
+std::pair<std::uint32_t, std::uint32_t> getGridStartCells(int columns, int rows)
+{
+    int headRow{ rows / 2 };
+    std::uint32_t headCell{ static_cast<std::uint32_t>(headRow * columns + (columns / 2)) };
+    std::uint32_t neckCell{ headRow + 1 < rows ? headCell + static_cast<std::uint32_t>(columns) : noGridCell };
+    return { headCell, neckCell };
+}
+
+bool advanceGridSnake(GridWorld& world)
+{
+    GridSnake& snake{ world.snake };
+    if (!isOppositeDirection(snake.currentDirection, snake.heading))
+        snake.heading = snake.currentDirection;
+
+    std::uint32_t nextCell{ getNeighbourCell(world, snake.body.front(), snake.heading) };
+    if (nextCell == noGridCell)
+    {
+        world.gameOver = true;
+        return false;
+    }
+
+    //The tail leaves before the head arrives, so following the tail around is not a collision
+    if (snake.body.size() >= snake.length)
+        popGridTail(world);
+    if (world.bodyCells.test(nextCell))
+    {
+        world.gameOver = true;
+        return false;
+    }
+    pushGridHead(world, nextCell);
+    ++world.moveCount;
+
+    //Growth is capped at the board, or a full board would leave the body short of its length with no cell to grow into
+    if (world.foodCells.test(nextCell))
+    {
+        if (snake.length < world.bodyCells.size())
+            ++snake.length;
+        removeGridFoodPiece(world, nextCell);
+    }
+    return true;
+}
+
+bool isGridMoveDue(const GridWorld& world, float dt)
+{
+    return world.moveProgress + (snakeMovespeed * dt) >= gridCellSize;
+}
+
+std::uint32_t getNeighbourCell(const GridWorld& world, std::uint32_t cell, SnakeDirection direction)
+{
+    int row{ static_cast<int>(cell / static_cast<std::uint32_t>(world.columns)) };
+    int column{ static_cast<int>(cell % static_cast<std::uint32_t>(world.columns)) };
+    switch (direction)
+    {
+        case MOVING_UP:
+            --row;
+            break;
+        case MOVING_DOWN:
+            ++row;
+            break;
+        case MOVING_LEFT:
+            ++column;
+            break;
+        case MOVING_RIGHT:
+            --column;
+            break;
+    }
+    if (row < 0 || row >= world.rows || column < 0 || column >= world.columns)
+        return noGridCell;
+    return static_cast<std::uint32_t>(row * world.columns + column);
+}
+
+bool isOppositeDirection(SnakeDirection first, SnakeDirection second)
+{
+    switch (first)
+    {
+        case MOVING_UP:
+            return second == MOVING_DOWN;
+        case MOVING_DOWN:
+            return second == MOVING_UP;
+        case MOVING_LEFT:
+            return second == MOVING_RIGHT;
+        case MOVING_RIGHT:
+            return second == MOVING_LEFT;
+    }
+    return false;
+}
+
+void pushGridHead(GridWorld& world, std::uint32_t cell)
+{
+    world.snake.body.push_front(cell);
+    world.bodyCells.set(cell);
+}
+
+void popGridTail(GridWorld& world)
+{
+    world.bodyCells.reset(world.snake.body.back());
+    world.snake.body.pop_back();
+}
+
+bool addGridFood(GridWorld& world)
+{
+    std::uint32_t cellCount{ static_cast<std::uint32_t>(world.bodyCells.size()) };
+    for (int attempt{ 0 }; attempt < foodPlacementRetries; attempt++)
+    {
+        std::uint32_t cell{ world.randomGen.next() % cellCount };
+        if (!world.bodyCells.test(cell) && !world.foodCells.test(cell))
+        {
+            addGridFoodPiece(world, cell);
+            return true;
+        }
+    }
+
+    //Count the free cells a word at a time, then walk to the chosen one
+    std::size_t wordCount{ world.bodyCells.wordCount() };
+    std::uint64_t lastWordMask{ world.bodyCells.unusedMask() };
+    std::uint32_t freeCount{ 0 };
+    for (std::size_t i{ 0 }; i < wordCount; i++)
+    {
+        std::uint64_t taken{ world.bodyCells.word(i) | world.foodCells.word(i) | (i + 1 == wordCount ? lastWordMask : 0) };
+        freeCount += static_cast<std::uint32_t>(countBits(~taken));
+    }
+    if (freeCount == 0)
+        return false;
+
+    std::uint32_t pick{ world.randomGen.next() % freeCount };
+    for (std::size_t i{ 0 }; i < wordCount; i++)
+    {
+        std::uint64_t freeBits{ ~(world.bodyCells.word(i) | world.foodCells.word(i) | (i + 1 == wordCount ? lastWordMask : 0)) };
+        std::uint32_t wordFree{ static_cast<std::uint32_t>(countBits(freeBits)) };
+        if (pick >= wordFree)
+        {
+            pick -= wordFree;
+            continue;
+        }
+        for (; pick > 0; pick--)
+            freeBits &= freeBits - 1;
+        std::uint32_t bit{ 0 };
+        while (!((freeBits >> bit) & 1))
+            ++bit;
+        addGridFoodPiece(world, static_cast<std::uint32_t>(i * 64) + bit);
+        return true;
+    }
+    return false;
+}
+
+void addGridFoodPiece(GridWorld& world, std::uint32_t cell)
+{
+    world.foodSlots[cell] = static_cast<std::uint32_t>(world.foodContainer.size());
+    world.foodContainer.push_back(cell);
+    world.foodCells.set(cell);
+}
+
+//Swaps the last piece into the removed one's place
+void removeGridFoodPiece(GridWorld& world, std::uint32_t cell)
+{
+    std::uint32_t slot{ world.foodSlots[cell] };
+    std::uint32_t lastCell{ world.foodContainer.back() };
+    world.foodContainer[slot] = lastCell;
+    world.foodSlots[lastCell] = slot;
+    world.foodContainer.pop_back();
+    world.foodCells.reset(cell);
+}
+
+std::pair<float, float> getCellCenter(const GridWorld& world, std::uint32_t cell)
+{
+    float originX{ platformCenterX - (world.rows * gridCellSize * 0.5f) };
+    float originZ{ platformCenterZ - (world.columns * gridCellSize * 0.5f) };
+    float row{ static_cast<float>(cell / static_cast<std::uint32_t>(world.columns)) };
+    float column{ static_cast<float>(cell % static_cast<std::uint32_t>(world.columns)) };
+    return { originX + ((row + 0.5f) * gridCellSize), originZ + ((column + 0.5f) * gridCellSize) };
+}
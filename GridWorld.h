@@ -0,0 +1,99 @@
+//Discrete alternative to SnakeWorld: the platform is split into cells one snake width across, the snake moves a
+//whole cell at a time and its body is a queue of cell indices. Packed bitsets mark the cells the body and the food
+//cover, so self and food collisions are one bit test per move however long the snake gets
+
+#ifndef GRID_WORLD_H
+#define GRID_WORLD_H
+
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+#include "SnakeWorld.h"
+#include "RingBuffer.h"
+#include "OccupancyBitset.h"
+
+enum GameMode
+{
+    MODE_CONTINUOUS,
+    MODE_GRID
+};
+
+//Parses "continuous" or "grid", returns false for anything else
+bool parseGameMode(const char* name, GameMode& mode);
+
+//Cells are the same size as the broad-phase cells, 20 a side on the default platform
+const int gridBoardCells{ static_cast<int>(platformScale / gridCellSize) };
+
+//Returned by getNeighbourCell for a move off the board
+const std::uint32_t noGridCell{ 0xffffffffu };
+
+//Smallest board the starting body fits on, the neck starts one row below the head in the middle row
+const int minGridColumns{ 2 };
+const int minGridRows{ 3 };
+
+//Cell c is at row c / columns and column c % columns. Rows run along +X (down) and columns along +Z (left)
+struct GridSnake
+{
+    RingBuffer<std::uint32_t> body{}; //Cell indices, head first
+    SnakeDirection currentDirection{ MOVING_UP }; //Requested direction, applied on the next move
+    SnakeDirection heading{ MOVING_UP }; //Direction of the last move, a request to reverse onto it is ignored
+    std::uint32_t length{ 4 }; //Cells the body grows to, the tail stays put while the body is shorter
+};
+
+struct GridWorld
+{
+    int columns{ gridBoardCells };
+    int rows{ gridBoardCells };
+    GridSnake snake{};
+    OccupancyBitset bodyCells{};
+    OccupancyBitset foodCells{};
+    std::vector<std::uint32_t> foodContainer{}; //Cells holding food, in no particular order
+    std::vector<std::uint32_t> foodSlots{}; //Index into foodContainer for every cell with food, so eating is O(1)
+    GameRng randomGen{};
+    std::uint64_t seed{ 0 };
+    std::uint64_t stepCount{ 0 };
+    std::uint64_t moveCount{ 0 };
+    float moveProgress{ 0.0f }; //Distance covered towards the next cell, the snake moves at snakeMovespeed like in SnakeWorld
+    bool gameOver{ false };
+
+    bool spawnedFood{ false };
+    std::uint32_t spawnedFoodCell{ 0 };
+
+    GridWorld();
+    explicit GridWorld(std::uint64_t seed, RngEngine engine = RNG_XOSHIRO, int columns = gridBoardCells, int rows = gridBoardCells);
+
+    //Restarts the game on a fresh stream from seed, keeping the current engine and board size
+    void reset(std::uint64_t seed);
+
+    //One fixed tick: spawns food on the same schedule as SnakeWorld and moves a cell whenever a cell's worth of distance is covered
+    void step(float dt);
+};
+
+//True if a board of this size can be played: at least minGridColumns by minGridRows, with every cell index
+//small enough for an int
+bool isValidGridBoard(int columns, int rows);
+
+//Head and neck cells the body starts on, the neck is noGridCell if the board is too short for it
+std::pair<std::uint32_t, std::uint32_t> getGridStartCells(int columns, int rows);
+
+//Moves the head one cell, returns false and sets gameOver if it left the board or ran into the body
+bool advanceGridSnake(GridWorld& world);
+
+//True if the next step(dt) moves the snake, so a planner only has to run when its answer is used
+bool isGridMoveDue(const GridWorld& world, float dt);
+
+std::uint32_t getNeighbourCell(const GridWorld& world, std::uint32_t cell, SnakeDirection direction);
+bool isOppositeDirection(SnakeDirection first, SnakeDirection second);
+void pushGridHead(GridWorld& world, std::uint32_t cell);
+void popGridTail(GridWorld& world);
+
+//Tries a few random cells, then picks uniformly among the free ones. Returns false only when the board is full
+bool addGridFood(GridWorld& world);
+void addGridFoodPiece(GridWorld& world, std::uint32_t cell);
+void removeGridFoodPiece(GridWorld& world, std::uint32_t cell);
+
+//Centre of a cell in platform coordinates, boards of any size are centred on the platform
+std::pair<float, float> getCellCenter(const GridWorld& world, std::uint32_t cell);
+
+#endif
@@ -0,0 +1,133 @@
+#include "HamiltonianSolver.h"
+
+#include <iterator>
+
+namespace
+{
+    //Checks at compile time that consecutive places are neighbouring cells, including the wrap from the last back to the first
+    template <int Columns, int Rows>
+    constexpr bool isHamiltonianCycle(const CyclePositions<Columns, Rows>& table)
+    {
+        const int count{ Columns * Rows };
+        std::uint32_t cells[count]{};
+        for (int cell{ 0 }; cell < count; cell++)
+            cells[table.positions[cell]] = static_cast<std::uint32_t>(cell);
+        for (int place{ 0 }; place < count; place++)
+        {
+            int from{ static_cast<int>(cells[place]) };
+            int to{ static_cast<int>(cells[(place + 1) % count]) };
+            int rowStep{ to / Columns - from / Columns };
+            int columnStep{ to % Columns - from % Columns };
+            if ((rowStep * rowStep) + (columnStep * columnStep) != 1)
+                return false;
+        }
+        return true;
+    }
+
+    constexpr CyclePositions<precomputedCycleSide, precomputedCycleSide> precomputedCyclePositions{
+        makeCyclePositions<precomputedCycleSide, precomputedCycleSide>()
+    };
+    static_assert(isHamiltonianCycle(precomputedCyclePositions), "precomputed cycle is broken");
+}
+
+bool initHamiltonianCycle(HamiltonianCycle& cycle, const GridWorld& world)
+{
+    bool transpose{ world.rows % 2 == 1 };
+    if ((transpose && world.columns % 2 == 1) || !isValidGridBoard(world.columns, world.rows))
+        return false;
+
+    std::size_t cellCount{ static_cast<std::size_t>(world.columns) * static_cast<std::size_t>(world.rows) };
+    cycle.columns = world.columns;
+    cycle.rows = world.rows;
+    if (world.columns == precomputedCycleSide && world.rows == precomputedCycleSide)
+    {
+        cycle.position.assign(std::begin(precomputedCyclePositions.positions), std::end(precomputedCyclePositions.positions));
+    }
+    else
+    {
+        //Odd row counts run the same pattern down the columns instead
+        cycle.position.resize(cellCount);
+        for (int row{ 0 }; row < world.rows; row++)
+        {
+            for (int column{ 0 }; column < world.columns; column++)
+            {
+                cycle.position[row * world.columns + column] = transpose
+                    ? getSerpentineCyclePosition(column, row, world.columns, world.rows)
+                    : getSerpentineCyclePosition(row, column, world.rows, world.columns);
+            }
+        }
+    }
+
+    //The neck stays put until the body has grown, so the cycle is followed in whichever direction reaches it last.
+    //Heading towards it, the head could get there first and be walled in on a small board
+    std::pair<std::uint32_t, std::uint32_t> startCells{ getGridStartCells(world.columns, world.rows) };
+    std::size_t neckDistance{ (cycle.position[startCells.second] + cellCount - cycle.position[startCells.first]) % cellCount };
+    if (neckDistance < cellCount - neckDistance)
+    {
+        for (std::size_t cell{ 0 }; cell < cellCount; cell++)
+            cycle.position[cell] = static_cast<std::uint32_t>((cellCount - cycle.position[cell]) % cellCount);
+    }
+
+    cycle.cellAt.resize(cellCount);
+    for (std::size_t cell{ 0 }; cell < cellCount; cell++)
+        cycle.cellAt[cycle.position[cell]] = static_cast<std::uint32_t>(cell);
+    return true;
+}
+
+std::uint32_t getCycleDistance(const HamiltonianCycle& cycle, std::uint32_t from, std::uint32_t to)
+{
+    std::uint32_t cellCount{ static_cast<std::uint32_t>(cycle.position.size()) };
+    return (cycle.position[to] + cellCount - cycle.position[from]) % cellCount;
+}
+
+SnakeDirection planHamiltonianMove(const HamiltonianCycle& cycle, const GridWorld& world)
+{
+    const GridSnake& snake{ world.snake };
+    std::uint32_t cellCount{ static_cast<std::uint32_t>(cycle.position.size()) };
+    std::uint32_t headCell{ snake.body.front() };
+    std::uint32_t nextCell{ cycle.cellAt[(cycle.position[headCell] + 1) % cellCount] };
+
+    //The body trails the head along the cycle, so the tail is the furthest the head can jump ahead without landing
+    //on the body, less whatever the body will still grow by before the tail starts moving
+    std::uint32_t bodySize{ static_cast<std::uint32_t>(snake.body.size()) };
+    std::uint32_t growth{ snake.length > bodySize ? snake.length - bodySize : 0 };
+    bool shortcutsAllowed{ static_cast<float>(bodySize + growth) < shortcutBoardFraction * static_cast<float>(cellCount) };
+    std::uint32_t tailDistance{ getCycleDistance(cycle, headCell, snake.body.back()) };
+    if (shortcutsAllowed && tailDistance > growth + shortcutMargin)
+    {
+        std::uint32_t maxJump{ tailDistance - growth - shortcutMargin };
+        for (std::uint32_t foodCell : world.foodContainer)
+        {
+            std::uint32_t foodDistance{ getCycleDistance(cycle, headCell, foodCell) };
+            if (foodDistance > 0 && foodDistance < maxJump)
+                maxJump = foodDistance;
+        }
+
+        std::uint32_t bestDistance{ 1 };
+        for (SnakeDirection direction : { MOVING_UP, MOVING_DOWN, MOVING_LEFT, MOVING_RIGHT })
+        {
+            std::uint32_t neighbour{ getNeighbourCell(world, headCell, direction) };
+            if (neighbour == noGridCell || world.bodyCells.test(neighbour))
+                continue;
+            std::uint32_t distance{ getCycleDistance(cycle, headCell, neighbour) };
+            if (distance > bestDistance && distance <= maxJump)
+            {
+                bestDistance = distance;
+                nextCell = neighbour;
+            }
+        }
+    }
+    return getDirectionBetween(world, headCell, nextCell);
+}
+
+SnakeDirection getDirectionBetween(const GridWorld& world, std::uint32_t from, std::uint32_t to)
+{
+    std::uint32_t columns{ static_cast<std::uint32_t>(world.columns) };
+    if (to + columns == from)
+        return MOVING_UP;
+    if (from + columns == to)
+        return MOVING_DOWN;
+    if (to == from + 1)
+        return MOVING_LEFT;
+    return MOVING_RIGHT;
+}
@@ -0,0 +1,79 @@
+//Perfect play for grid mode: a cycle through every cell of the board, which the snake follows, cutting corners
+//only while it is short enough that a shortcut cannot strand it. A snake on the cycle never runs into itself,
+//so games run all the way to a full board
+
+#ifndef HAMILTONIAN_SOLVER_H
+#define HAMILTONIAN_SOLVER_H
+
+#include <vector>
+#include <cstdint>
+
+#include "GridWorld.h"
+
+//Side of the board whose cycle is built at compile time, gridBoardCells on the default platform
+const int precomputedCycleSide{ 20 };
+
+//Shortcuts are only taken while the body fills less than this fraction of the board
+const float shortcutBoardFraction{ 0.5f };
+
+//Cells kept between the head and the tail, on top of any growth still to come, when taking a shortcut
+const std::uint32_t shortcutMargin{ 4 };
+
+struct HamiltonianCycle
+{
+    int columns{ 0 };
+    int rows{ 0 };
+    std::vector<std::uint32_t> position{}; //Place of each cell along the cycle
+    std::vector<std::uint32_t> cellAt{}; //Cell at each place along the cycle
+};
+
+//Place of the cell at (row, column) along a cycle that runs along row 0, snakes back and forth over columns 1
+//onward of the remaining rows, then returns up column 0. Needs an even number of rows
+constexpr std::uint32_t getSerpentineCyclePosition(int row, int column, int rows, int columns)
+{
+    if (row == 0)
+        return static_cast<std::uint32_t>(column);
+    if (column == 0)
+        return static_cast<std::uint32_t>(columns + (rows - 1) * (columns - 1) + (rows - 1 - row));
+    std::uint32_t rowStart{ static_cast<std::uint32_t>(columns + (row - 1) * (columns - 1)) };
+    return rowStart + static_cast<std::uint32_t>(row % 2 == 1 ? (columns - 1) - column : column - 1);
+}
+
+//Places of every cell on a Columns x Rows board. A plain array in a literal struct rather than std::array, whose
+//non-const operator[] cannot be used in a constexpr function before C++17
+template <int Columns, int Rows>
+struct CyclePositions
+{
+    std::uint32_t positions[Columns * Rows];
+};
+
+template <int Columns, int Rows>
+constexpr CyclePositions<Columns, Rows> makeCyclePositions()
+{
+    static_assert(Rows % 2 == 0 && Columns >= 2, "the serpentine cycle needs an even number of rows");
+    CyclePositions<Columns, Rows> table{};
+    for (int row{ 0 }; row < Rows; row++)
+    {
+        for (int column{ 0 }; column < Columns; column++)
+            table.positions[row * Columns + column] = getSerpentineCyclePosition(row, column, Rows, Columns);
+    }
+    return table;
+}
+
+//Builds the cycle for world's board, the default board comes from a table computed at compile time. The cycle
+//runs away from the neck the body starts with. Returns false if the board has no Hamiltonian cycle, which is when
+//both sides are odd, or fails isValidGridBoard
+bool initHamiltonianCycle(HamiltonianCycle& cycle, const GridWorld& world);
+
+//Places from one cell forward along the cycle to another
+std::uint32_t getCycleDistance(const HamiltonianCycle& cycle, std::uint32_t from, std::uint32_t to);
+
+//Direction for the snake's next move: the next cell on the cycle, or the neighbour furthest along it that is
+//still safely short of the tail and not past the nearest food. The game must have started from GridWorld::reset
+//on the cycle's board and been planned by this since, so the body trails the head along the cycle
+SnakeDirection planHamiltonianMove(const HamiltonianCycle& cycle, const GridWorld& world);
+
+//Direction of a move from a cell to a neighbouring one
+SnakeDirection getDirectionBetween(const GridWorld& world, std::uint32_t from, std::uint32_t to);
+
+#endif
@@ -0,0 +1,173 @@
+#include "InputLog.h"
+
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+const char* const inputLogHeader{ "snake-input 1" };
+const char* const directionNames[]{ "up", "down", "left", "right" };
+
+void recordInput(InputLog& log, std::uint64_t tick, SnakeDirection direction)
+{
+    SnakeDirection lastDirection{ log.events.empty() ? MOVING_UP : log.events.back().direction };
+    if (direction != lastDirection)
+        log.events.push_back(InputEvent{ tick, direction });
+}
+
+void finishInputLog(InputLog& log, SnakeWorld& world)
+{
+    log.finalTick = world.stepCount;
+    log.finalHash = hashWorldState(world);
+}
+
+//Plain text, one record per line:
+//  snake-input 1
+//  seed <n>
+//  rng minstd|xoshiro
+//  tick-rate <ticks per second>
+//  input <tick> up|down|left|right
+//  end <final tick> <final hash in hex>
+bool saveInputLog(InputLog& log, const std::string& path)
+{
+    std::ofstream file{ path };
+    if (!file)
+        return false;
+
+    file << inputLogHeader << '\n';
+    file << "seed " << log.seed << '\n';
+    file << "rng " << (log.engine == RNG_MINSTD ? "minstd" : "xoshiro") << '\n';
+    file << "tick-rate " << std::setprecision(17) << log.ticksPerSecond << '\n';
+    for (auto& event : log.events)
+        file << "input " << event.tick << ' ' << directionNames[event.direction] << '\n';
+    file << "end " << log.finalTick << ' ' << std::hex << log.finalHash << std::dec << '\n';
+    return static_cast<bool>(file);
+}
+
+static bool parseDirection(const std::string& name, SnakeDirection& direction)
+{
+    for (int i{ 0 }; i < 4; i++)
+    {
+        if (name == directionNames[i])
+        {
+            direction = static_cast<SnakeDirection>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool loadInputLog(InputLog& log, const std::string& path)
+{
+    std::ifstream file{ path };
+    std::string line{};
+    if (!file || !std::getline(file, line) || line != inputLogHeader)
+        return false;
+
+    log = InputLog{};
+    bool ended{ false };
+    while (std::getline(file, line))
+    {
+        std::istringstream fields{ line };
+        std::string key{};
+        fields >> key;
+        if (key == "seed")
+            fields >> log.seed;
+        else if (key == "rng")
+        {
+            std::string name{};
+            fields >> name;
+            if (!parseRngEngine(name.c_str(), log.engine))
+                return false;
+        }
+        else if (key == "tick-rate")
+            fields >> log.ticksPerSecond;
+        else if (key == "input")
+        {
+            InputEvent event{};
+            std::string name{};
+            fields >> event.tick >> name;
+            if (!parseDirection(name, event.direction))
+                return false;
+            log.events.push_back(event);
+        }
+        else if (key == "end")
+        {
+            fields >> log.finalTick >> std::hex >> log.finalHash;
+            ended = true;
+        }
+        else if (!key.empty())
+            return false;
+
+        if (fields.fail())
+            return false;
+    }
+    return ended && log.ticksPerSecond > 0.0;
+}
+
+std::uint64_t replayInputLog(InputLog& log, SnakeWorld& world)
+{
+    world = SnakeWorld{ log.seed, log.engine };
+    //Same conversion the live game's clock makes, so every step sees a bit-identical dt
+    GameClock clock{ log.ticksPerSecond };
+    float tickSeconds{ static_cast<float>(clock.tickSeconds) };
+
+    std::size_t nextEvent{ 0 };
+    while (world.stepCount < log.finalTick && !world.gameOver)
+    {
+        while (nextEvent < log.events.size() && log.events[nextEvent].tick <= world.stepCount)
+            world.snake.currentDirection = log.events[nextEvent++].direction;
+        world.step(tickSeconds);
+    }
+    return hashWorldState(world);
+}
+
+static void hashBytes(std::uint64_t& hash, const void* data, std::size_t size)
+{
+    const unsigned char* bytes{ static_cast<const unsigned char*>(data) };
+    for (std::size_t i{ 0 }; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+}
+
+static void hashFloat(std::uint64_t& hash, float value)
+{
+    std::uint32_t bits{};
+    std::memcpy(&bits, &value, sizeof(bits));
+    hashBytes(hash, &bits, sizeof(bits));
+}
+
+static void hashInteger(std::uint64_t& hash, std::uint64_t value)
+{
+    hashBytes(hash, &value, sizeof(value));
+}
+
+std::uint64_t hashWorldState(SnakeWorld& world)
+{
+    std::uint64_t hash{ 14695981039346656037ull };
+    hashInteger(hash, world.stepCount);
+    hashInteger(hash, world.gameOver ? 1 : 0);
+    hashInteger(hash, world.snake.currentDirection);
+    hashFloat(hash, world.snake.length);
+    hashFloat(hash, world.snake.bodyLength);
+
+    hashInteger(hash, world.snake.snakeBody.size());
+    for (auto& segment : world.snake.snakeBody)
+    {
+        hashFloat(hash, segment.frontCoord.first);
+        hashFloat(hash, segment.frontCoord.second);
+        hashFloat(hash, segment.backCoord.first);
+        hashFloat(hash, segment.backCoord.second);
+        hashInteger(hash, segment.direction);
+    }
+
+    hashInteger(hash, world.foodContainer.size());
+    for (auto& foodPiece : world.foodContainer)
+    {
+        hashFloat(hash, foodPiece.first);
+        hashFloat(hash, foodPiece.second);
+    }
+    return hash;
+}
@@ -0,0 +1,44 @@
+//Recorded direction changes keyed by simulation tick, replaying them against the same seed reproduces a game exactly
+
+#ifndef INPUT_LOG_H
+#define INPUT_LOG_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "SnakeWorld.h"
+#include "GameClock.h"
+
+//Applied to snake.currentDirection just before the step that advances stepCount past tick
+struct InputEvent
+{
+    std::uint64_t tick{ 0 };
+    SnakeDirection direction{};
+};
+
+struct InputLog
+{
+    std::uint64_t seed{ 0 };
+    RngEngine engine{ RNG_XOSHIRO };
+    double ticksPerSecond{ defaultTicksPerSecond };
+    std::vector<InputEvent> events{};
+
+    //Filled in when recording stops, replay runs to finalTick and compares against finalHash
+    std::uint64_t finalTick{ 0 };
+    std::uint64_t finalHash{ 0 };
+};
+
+//Logs direction only when it differs from the last recorded one, the world starts out MOVING_UP
+void recordInput(InputLog& log, std::uint64_t tick, SnakeDirection direction);
+void finishInputLog(InputLog& log, SnakeWorld& world);
+bool saveInputLog(InputLog& log, const std::string& path);
+bool loadInputLog(InputLog& log, const std::string& path);
+
+//Runs the log headlessly from a fresh world as fast as possible, returns the hash of the final state
+std::uint64_t replayInputLog(InputLog& log, SnakeWorld& world);
+
+//FNV-1a over the bit patterns of everything step() reads or writes, equal hashes mean equal games
+std::uint64_t hashWorldState(SnakeWorld& world);
+
+#endif
@@ -4,9 +4,13 @@
 #include <GLFW/glfw3.h>
 #include <iostream>
 #include <vector>
+#include <string>
 #include <utility>
 #include <cmath>
-#include <random>
+#include <cstddef>
+#include <cstring>
+#include <cstdlib>
+#include <cstdint>
 #include <chrono>
 
 #include <glm/glm.hpp>
@@ -16,48 +20,42 @@
 #include <custom/camera.h>
 #include <custom/shader.h>
 
-
-enum SnakeDirection
-{
-    MOVING_UP,
-    MOVING_DOWN,
-    MOVING_LEFT,
-    MOVING_RIGHT
-};
-
-struct SnakeSegment
-{
-    std::pair<float, float> frontCoord{};
-    std::pair<float, float> backCoord{};
-    SnakeDirection direction{};
-};
-
-struct Snake
+#include "SnakeWorld.h"
+#include "GridWorld.h"
+#include "Autopilot.h"
+#include "HamiltonianSolver.h"
+#include "GameClock.h"
+#include "InputLog.h"
+#include "RenderState.h"
+#include "Profiler.h"
+#include "GpuTimer.h"
+#include "StreamBuffer.h"
+#include "Mesh.h"
+#include "SnakeMesh.h"
+
+//Per-instance attributes streamed to shader.vs, one box per platform, snake segment and food piece
+struct BoxInstance
 {
-    std::vector<SnakeSegment> snakeBody{};
-    SnakeDirection currentDirection{};
-    float length{ 1.0f };
+    glm::vec3 position{};
+    glm::vec3 scale{};
+    glm::vec3 color{};
 };
 
 void framebuffer_size_callback(GLFWwindow* window, int width, int height);
-void processInput(GLFWwindow* window, Snake& snake);
+void processInput(GLFWwindow* window, SnakeDirection& direction);
+int runReplay(const char* replayPath);
 void initializeProgram();
 bool initializeWindow(const unsigned int width, const unsigned int height, GLFWwindow* window);
-void initVertexObjects(unsigned int& VBO, unsigned int& VAO);
-void drawPlatform(glm::mat4& model, Shader& ourShader);
-void drawSnake(glm::mat4& model, Shader& ourShader, Snake& snake);
-void drawFood(glm::mat4& model, Shader& ourShader, std::vector<std::pair<float, float>>& foodContainer);
-void moveSnake(Snake& snake);
-void handleMovement(Snake& snake, bool moveBack);
-float getSnakeLength(Snake& snake);
-void addSegment(Snake& snake);
-float getSegmentLength(SnakeSegment& snakeSegment, bool inX);
-void handleCollisions(GLFWwindow* window, Snake& snake, std::vector<std::pair<float, float>>& foodContainer);
-bool checkCollision(SnakeSegment& frontSegment, SnakeSegment& segment);
-bool inBox(float x1, float x2, float z1, float z2, std::pair<float, float>& point);
-bool checkFoodCollision(SnakeSegment& segment, std::pair<float, float>& foodCoords);
-void addFood(Snake& snake, std::vector<std::pair<float,float>>& foodContainer);
-void setBoundsFromSegment(float& x1, float& x2, float& z1, float& z2, SnakeSegment& segment);
+void initVertexObjects(Mesh& cubeMesh);
+void addPlatformInstance(std::vector<BoxInstance>& instances);
+void addFoodInstances(std::vector<BoxInstance>& instances, std::vector<std::pair<float, float>>& foodContainer);
+void addGridSnakeInstances(std::vector<BoxInstance>& instances, GridWorld& gridWorld);
+void addGridFoodInstances(std::vector<BoxInstance>& instances, GridWorld& gridWorld);
+std::size_t uploadInstances(RenderState& renderState, StreamBuffer& instanceStream, std::vector<BoxInstance>& instances);
+void drawInstances(RenderState& renderState, const Mesh& mesh, StreamBuffer& instanceStream, std::size_t streamOffset, std::size_t first, std::size_t count);
+void initCameraBuffer(unsigned int& cameraUBO);
+void bindCameraBlock(unsigned int programID);
+void updateCameraBuffer(RenderState& renderState, unsigned int cameraUBO, glm::mat4& uploadedView, bool& viewUploaded);
 
 //Settings
 const unsigned int SCR_WIDTH{ 800 };
@@ -70,25 +68,93 @@ float pitch{ -90.0f };
 float yaw{ -90.0f };
 Camera camera{ camPos, camUp, 0.0f, -90.0f };
 
+//Camera uniform block shared by every program, re-uploaded only when the view or the framebuffer changes
+const unsigned int cameraBlockBinding{ 0 };
+const float viewHalfHeight{ 3.0f };
+int framebufferWidth{ SCR_WIDTH };
+int framebufferHeight{ SCR_HEIGHT };
+bool projectionDirty{ true };
+
 //Timing variables
 float deltaTime{ 0.0f }; // Time between current frame and last frame
 float lastFrame{ 0.0f }; // Time of last frame
 
-//Shader uniform
+//Box colors
 glm::vec3 platformColor{ glm::vec3(0.3f, 0.3f, 0.3f) };
 glm::vec3 snakeColor{ glm::vec3(1.0f, 1.0f, 0.0f) };
 glm::vec3 foodColor{ glm::vec3(1.0f, 1.0f, 1.0f) };
 
 //Platform variables
-glm::vec3 platformPosition{ glm::vec3(0.0f, -1.0f, 0.0f) };
-const float platformScale = 5.0f;
+glm::vec3 platformPosition{ glm::vec3(platformCenterX, -1.0f, platformCenterZ) };
 
-//Snake variables
-const float snakeMovespeed = 1.0f;
-const float snakeRadius = 0.125;
-
-int main()
+int main(int argc, char* argv[])
 {
+    //Command line options
+    double ticksPerSecond{ defaultTicksPerSecond };
+    std::uint64_t seed{ static_cast<std::uint64_t>(std::chrono::system_clock::now().time_since_epoch().count()) };
+    RngEngine rngEngine{ RNG_XOSHIRO };
+    GameMode gameMode{ MODE_CONTINUOUS };
+    bool autopilotEnabled{ false };
+    bool solverEnabled{ false };
+    const char* recordPath{ NULL };
+    const char* replayPath{ NULL };
+    const char* profilePath{ NULL };
+    for (int i{ 1 }; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--tick-rate") == 0 && i + 1 < argc)
+            ticksPerSecond = std::atof(argv[++i]);
+        else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            seed = std::strtoull(argv[++i], NULL, 10);
+        else if (std::strcmp(argv[i], "--rng") == 0 && i + 1 < argc)
+        {
+            if (!parseRngEngine(argv[++i], rngEngine))
+            {
+                std::cout << "--rng must be minstd or xoshiro" << std::endl;
+                return -1;
+            }
+        }
+        else if (std::strcmp(argv[i], "--mode") == 0 && i + 1 < argc)
+        {
+            if (!parseGameMode(argv[++i], gameMode))
+            {
+                std::cout << "--mode must be continuous or grid" << std::endl;
+                return -1;
+            }
+        }
+        else if (std::strcmp(argv[i], "--autopilot") == 0)
+            autopilotEnabled = true;
+        else if (std::strcmp(argv[i], "--solver") == 0)
+            solverEnabled = true;
+        else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+            recordPath = argv[++i];
+        else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+            replayPath = argv[++i];
+        else if (std::strcmp(argv[i], "--profile-out") == 0 && i + 1 < argc)
+            profilePath = argv[++i];
+    }
+#ifndef SNAKE_PROFILE
+    if (profilePath != NULL)
+        std::cout << "Built without SNAKE_PROFILE, --profile-out is ignored" << std::endl;
+#endif
+    if (replayPath != NULL)
+        return runReplay(replayPath);
+    bool selfPlaying{ autopilotEnabled || solverEnabled };
+    if (selfPlaying && gameMode != MODE_GRID)
+    {
+        std::cout << "The autopilot and solver plan over the grid, switching to --mode grid" << std::endl;
+        gameMode = MODE_GRID;
+    }
+    if (gameMode == MODE_GRID && recordPath != NULL)
+    {
+        std::cout << "Recording is only supported in continuous mode, --record is ignored" << std::endl;
+        recordPath = NULL;
+    }
+    if (ticksPerSecond <= 0.0)
+    {
+        std::cout << "--tick-rate must be positive" << std::endl;
+        return -1;
+    }
+
     initializeProgram();
 
     GLFWwindow* window{ glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "LearnOpenGL", NULL, NULL) };
@@ -97,73 +163,229 @@ int main()
 
     Shader ourShader("Resources/shader.vs", "Resources/shader.fs");
 
-    //Generate vertex buffer object, and connect vertices to it
-    unsigned int VBO, VAO;
-    initVertexObjects(VBO, VAO);
+    //Generate the indexed cube every box is drawn with, and hook the instance attributes onto its VAO
+    Mesh cubeMesh{};
+    initVertexObjects(cubeMesh);
 
-    ourShader.use();
+    //Generate the camera uniform buffer and point the program's camera block at it
+    unsigned int cameraUBO;
+    initCameraBuffer(cameraUBO);
+    bindCameraBlock(ourShader.ID);
+    glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+    glm::mat4 uploadedView{};
+    bool viewUploaded{ false };
 
-    //Enable depth testing and hide cursor + capture mouse
-    glEnable(GL_DEPTH_TEST);
-    glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+    //All binds in the frame loop go through renderState, which starts out matching the freshly unbound context
+    RenderState renderState{};
+    useProgram(renderState, ourShader.ID);
+
+    //Instances are streamed through a ring of regions, sized for a long snake up front and grown if a frame needs more
+    StreamBuffer instanceStream{};
+    initStreamBuffer(instanceStream, renderState, 1024 * sizeof(BoxInstance));
+    std::cout << "Instance streaming: " << getStreamModeName(instanceStream.mode) << std::endl;
 
-    glm::mat4 model{};
-    glm::mat4 view{};
-    glm::mat4 projection{};
+    //The snake body is its own mesh, patched in place each frame rather than streamed as instances
+    SnakeMesh snakeMesh{};
+    initSnakeMesh(snakeMesh, renderState);
 
-    //Init snake
-    Snake snake{};
-    snake.snakeBody.push_back(SnakeSegment{ {0.0f, 0.0f}, {0.5f, 0.0f}, MOVING_UP });
-    snake.currentDirection = MOVING_UP;
+    //Enable depth testing and back face culling, hide cursor + capture mouse
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_CULL_FACE);
+    glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
 
-    //Init food container
-    std::vector<std::pair<float, float>> foodContainer;
+    //Init snake and food container
+    //Only the world for the chosen mode is stepped and drawn
+    SnakeWorld world{ seed, rngEngine };
+    GridWorld gridWorld{ seed, rngEngine };
+    Autopilot autopilot{};
+    resizeAutopilot(autopilot, gridWorld);
+    std::uint64_t autopilotGames{ 0 };
+    HamiltonianCycle cycle{};
+    if (solverEnabled && !initHamiltonianCycle(cycle, gridWorld))
+    {
+        std::cout << "The board has no Hamiltonian cycle, falling back to the autopilot" << std::endl;
+        solverEnabled = false;
+    }
+    bool boardFullReported{ false };
+    std::cout << "Seed: " << seed << std::endl;
+    GameClock gameClock{ ticksPerSecond };
+    std::vector<BoxInstance> instances{};
+    InputLog inputLog{ seed, rngEngine, ticksPerSecond };
+    GpuTimer gpuTimer{};
+#ifdef SNAKE_PROFILE
+    float lastTitleUpdate{ 0.0f };
+    initGpuTimer(gpuTimer);
+#endif
 
-    int loopCount{ 0 };
     while (!glfwWindowShouldClose(window))
     {
+        PROFILE_SCOPE(PROFILE_FRAME);
+
         //Input
-        processInput(window, snake);
+        {
+            PROFILE_SCOPE(PROFILE_INPUT);
+            //The autopilot and solver set the direction themselves, the keyboard still handles escape
+            SnakeDirection ignoredDirection{};
+            if (selfPlaying)
+                processInput(window, ignoredDirection);
+            else
+                processInput(window, gameMode == MODE_GRID ? gridWorld.snake.currentDirection : world.snake.currentDirection);
+        }
 
         //Timing 
         float currentFrame = static_cast<float>(glfwGetTime());
         deltaTime = currentFrame - lastFrame;
         lastFrame = currentFrame;
 
+        //Simulation only advances in whole fixed ticks, so frame rate and vsync cannot change the outcome
+        {
+            PROFILE_SCOPE(PROFILE_SIMULATION);
+            int ticksDue{ gameClock.advance(deltaTime) };
+            for (int tick{ 0 }; tick < ticksDue && !world.gameOver && !gridWorld.gameOver; tick++)
+            {
+                if (gameMode == MODE_GRID)
+                {
+                    if (selfPlaying && isGridMoveDue(gridWorld, static_cast<float>(gameClock.tickSeconds)))
+                    {
+                        PROFILE_SCOPE(PROFILE_AUTOPILOT);
+                        gridWorld.snake.currentDirection = solverEnabled ? planHamiltonianMove(cycle, gridWorld) : planAutopilotMove(autopilot, gridWorld);
+                    }
+                    gridWorld.step(static_cast<float>(gameClock.tickSeconds));
+                    continue;
+                }
+                if (recordPath != NULL)
+                    recordInput(inputLog, world.stepCount, world.snake.currentDirection);
+                world.step(static_cast<float>(gameClock.tickSeconds));
+            }
+        }
+        //Unattended runs start the next game instead of closing, each on the next seed
+        if (solverEnabled && !boardFullReported && gridWorld.snake.body.size() == gridWorld.bodyCells.size())
+        {
+            std::cout << "Board full after " << gridWorld.moveCount << " moves" << std::endl;
+            boardFullReported = true;
+        }
+        if (selfPlaying && gridWorld.gameOver)
+        {
+            std::cout << "Game " << ++autopilotGames << " (seed " << gridWorld.seed << "): length " << gridWorld.snake.body.size()
+                << " after " << gridWorld.moveCount << " moves" << std::endl;
+            gridWorld.reset(gridWorld.seed + 1);
+        }
+        if (world.gameOver || gridWorld.gameOver)
+            glfwSetWindowShouldClose(window, true);
+
         //Rendering commands here, have to clear color and depth buffers before each drawing pass
         glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        // Create MVP matrices and send to shader 
-        view = camera.getViewMatrix();
-        ourShader.setMat4("view", view);
+        //Refresh the view and projection matrices in the camera block if they changed
+        {
+            PROFILE_SCOPE(PROFILE_CAMERA);
+            updateCameraBuffer(renderState, cameraUBO, uploadedView, viewUploaded);
+        }
 
-        projection = glm::ortho(-4.0f, 4.0f, -3.0f, 3.0f, 0.1f, 100.0f);
-        ourShader.setMat4("projection", projection);
-  
-        glBindVertexArray(VAO);
-        //Draw calls for platform, snake and food
-        drawPlatform(model, ourShader);
-        drawSnake(model, ourShader, snake);
-        drawFood(model, ourShader, foodContainer);
+        //Gather the platform and food boxes for this frame into one instance buffer upload, grid mode
+        //draws its snake as one box per cell from the same buffer
+        std::size_t snakeFirst{ 0 };
+        std::size_t foodFirst{ 0 };
+        std::size_t streamOffset{ 0 };
+        {
+            PROFILE_SCOPE(PROFILE_GATHER);
+            instances.clear();
+            addPlatformInstance(instances);
+            snakeFirst = instances.size();
+            if (gameMode == MODE_GRID)
+                addGridSnakeInstances(instances, gridWorld);
+            foodFirst = instances.size();
+            if (gameMode == MODE_GRID)
+                addGridFoodInstances(instances, gridWorld);
+            else
+                addFoodInstances(instances, world.foodContainer);
+        }
+        {
+            PROFILE_SCOPE(PROFILE_UPLOAD);
+            streamOffset = uploadInstances(renderState, instanceStream, instances);
+            if (gameMode == MODE_CONTINUOUS)
+                updateSnakeMesh(snakeMesh, renderState, world.snake, gameClock.alpha() * static_cast<float>(gameClock.tickSeconds) * snakeMovespeed);
+        }
 
-        if (loopCount % 125 == 0)
         {
-            addFood(snake, foodContainer);
-            loopCount = 0;
+            PROFILE_SCOPE(PROFILE_DRAW);
+            beginGpuFrame(gpuTimer);
+            useProgram(renderState, ourShader.ID);
+            //Draw calls for platform, snake and food, each timed on the GPU in profiled builds
+            beginGpuPass(gpuTimer, GPU_PASS_PLATFORM);
+            drawInstances(renderState, cubeMesh, instanceStream, streamOffset, 0, snakeFirst);
+            endGpuPass(gpuTimer);
+            beginGpuPass(gpuTimer, GPU_PASS_SNAKE);
+            if (gameMode == MODE_GRID)
+                drawInstances(renderState, cubeMesh, instanceStream, streamOffset, snakeFirst, foodFirst - snakeFirst);
+            else
+                drawSnakeMesh(snakeMesh, renderState, world.snake, snakeColor);
+            endGpuPass(gpuTimer);
+            beginGpuPass(gpuTimer, GPU_PASS_FOOD);
+            drawInstances(renderState, cubeMesh, instanceStream, streamOffset, foodFirst, instances.size() - foodFirst);
+            endGpuPass(gpuTimer);
+            endGpuFrame(gpuTimer);
+            finishStreamFrame(instanceStream);
+            endRenderFrame(renderState);
         }
-        ++loopCount;
 
-        moveSnake(snake);
-        handleCollisions(window, snake, foodContainer);
+#ifdef SNAKE_PROFILE
+        //Frame percentiles in the title bar, refreshed once a second so the title itself stays off the profile
+        if (currentFrame - lastTitleUpdate >= 1.0f)
+        {
+            StageSummary frameSummary{ summarizeStage(PROFILE_FRAME) };
+            std::string title{ "LearnOpenGL | frame p50 " + std::to_string(frameSummary.p50Ms) + " ms, p99 " + std::to_string(frameSummary.p99Ms) + " ms" };
+            glfwSetWindowTitle(window, title.c_str());
+            lastTitleUpdate = currentFrame;
+        }
+#endif
 
         //Check and call events and swap the buffers
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+        {
+            PROFILE_SCOPE(PROFILE_SWAP);
+            glfwSwapBuffers(window);
+            glfwPollEvents();
+        }
+    }
+
+#ifdef SNAKE_PROFILE
+    const char* reportPath{ profilePath != NULL ? profilePath : "profile.json" };
+    if (writeProfileReport(reportPath))
+        std::cout << "Wrote profile to " << reportPath << std::endl;
+    else
+        std::cout << "Failed to write " << reportPath << std::endl;
+    if (gpuTimer.droppedResults > 0)
+        std::cout << gpuTimer.droppedResults << " GPU timings were not ready in time and were skipped" << std::endl;
+#endif
+    deleteGpuTimer(gpuTimer);
+
+    if (recordPath != NULL)
+    {
+        finishInputLog(inputLog, world);
+        if (saveInputLog(inputLog, recordPath))
+            std::cout << "Recorded " << inputLog.finalTick << " ticks to " << recordPath << std::endl;
+        else
+            std::cout << "Failed to write " << recordPath << std::endl;
+    }
+
+    if (renderState.frames > 0)
+    {
+        std::cout << "GL state calls per frame: " << renderState.totalStats.issued / renderState.frames << " issued, "
+            << renderState.totalStats.avoided / renderState.frames << " avoided" << std::endl;
+        std::cout << "Snake segments uploaded per frame: " << static_cast<double>(snakeMesh.segmentWrites) / renderState.frames << std::endl;
     }
 
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
+    if (autopilot.plans > 0)
+        std::cout << "Autopilot: " << autopilot.plans << " plans, " << autopilot.fallbackPlans << " with no food in reach" << std::endl;
+
+    if (instanceStream.stalls > 0)
+        std::cout << "Instance stream waited on the GPU " << instanceStream.stalls << " times" << std::endl;
+
+    deleteStreamBuffer(instanceStream, renderState);
+    deleteSnakeMesh(snakeMesh);
+    deleteMesh(cubeMesh);
+    glDeleteBuffers(1, &cameraUBO);
 
     glfwTerminate();
     return 0;
@@ -172,28 +394,61 @@ int main()
 void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 {
     glViewport(0, 0, width, height);
+    framebufferWidth = width;
+    framebufferHeight = height;
+    projectionDirty = true;
 }
 
-void processInput(GLFWwindow* window, Snake& snake)
+void processInput(GLFWwindow* window, SnakeDirection& direction)
 {
     if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
         glfwSetWindowShouldClose(window, true);
     if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS)
     {
-        snake.currentDirection = MOVING_UP;
+        direction = MOVING_UP;
     }    
     else if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS)
     {
-        snake.currentDirection = MOVING_DOWN;
+        direction = MOVING_DOWN;
     }       
     else if (glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS)
     {
-        snake.currentDirection = MOVING_LEFT;
+        direction = MOVING_LEFT;
     }
     else if (glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS)
     {
-        snake.currentDirection = MOVING_RIGHT;
+        direction = MOVING_RIGHT;
+    }
+}
+
+//Replays a recorded session without opening a window, reports throughput and whether the final state still matches
+int runReplay(const char* replayPath)
+{
+    InputLog inputLog{};
+    if (!loadInputLog(inputLog, replayPath))
+    {
+        std::cout << "Failed to read " << replayPath << std::endl;
+        return -1;
+    }
+
+    SnakeWorld world{};
+    auto start{ std::chrono::steady_clock::now() };
+    std::uint64_t finalHash{ replayInputLog(inputLog, world) };
+    double seconds{ std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() };
+
+    std::cout << "Replayed " << world.stepCount << " ticks in " << seconds * 1000.0 << " ms";
+    if (seconds > 0.0)
+        std::cout << " (" << static_cast<double>(world.stepCount) / seconds << " ticks/s)";
+    std::cout << std::endl;
+
+    if (world.stepCount != inputLog.finalTick || finalHash != inputLog.finalHash)
+    {
+        std::cout << "State mismatch: expected tick " << inputLog.finalTick << " hash " << std::hex << inputLog.finalHash
+            << ", got tick " << std::dec << world.stepCount << " hash " << std::hex << finalHash << std::dec << std::endl;
+        return 1;
     }
+    std::cout << "Final state matches, hash " << std::hex << finalHash << std::dec << std::endl;
+    return 0;
 }
 
 void initializeProgram()
@@ -225,445 +480,117 @@ bool initializeWindow(const unsigned int width, const unsigned int height, GLFWw
     return true;
 }
 
-void initVertexObjects(unsigned int& VBO, unsigned int& VAO)
+void initVertexObjects(Mesh& cubeMesh)
 {
-    float vertices[] = {
-    -0.5f, -0.5f, -0.5f, 
-     0.5f, -0.5f, -0.5f, 
-     0.5f,  0.5f, -0.5f,
-     0.5f,  0.5f, -0.5f,
-    -0.5f,  0.5f, -0.5f,
-    -0.5f, -0.5f, -0.5f,
-
-    -0.5f, -0.5f,  0.5f,
-     0.5f, -0.5f,  0.5f,
-     0.5f,  0.5f,  0.5f,
-     0.5f,  0.5f,  0.5f,
-    -0.5f,  0.5f,  0.5f,
-    -0.5f, -0.5f,  0.5f,
-
-    -0.5f,  0.5f,  0.5f,
-    -0.5f,  0.5f, -0.5f,
-    -0.5f, -0.5f, -0.5f,
-    -0.5f, -0.5f, -0.5f,
-    -0.5f, -0.5f,  0.5f,
-    -0.5f,  0.5f,  0.5f,
-
-     0.5f,  0.5f,  0.5f,
-     0.5f,  0.5f, -0.5f,
-     0.5f, -0.5f, -0.5f,
-     0.5f, -0.5f, -0.5f,
-     0.5f, -0.5f,  0.5f,
-     0.5f,  0.5f,  0.5f,
-
-    -0.5f, -0.5f, -0.5f,
-     0.5f, -0.5f, -0.5f,
-     0.5f, -0.5f,  0.5f,
-     0.5f, -0.5f,  0.5f,
-    -0.5f, -0.5f,  0.5f,
-    -0.5f, -0.5f, -0.5f,
-
-    -0.5f,  0.5f, -0.5f,
-     0.5f,  0.5f, -0.5f,
-     0.5f,  0.5f,  0.5f,
-     0.5f,  0.5f,  0.5f,
-    -0.5f,  0.5f,  0.5f,
-    -0.5f,  0.5f, -0.5f
-    };
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-
-    //Bind the Vertex Array Object first, then bind and set vertex buffer(s), and then configure vertex attributes(s).
-    glBindVertexArray(VAO);
-
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-
-    //Note that this is allowed, the call to glVertexAttribPointer registered VBO as the vertex attribute's bound vertex buffer object so afterwards we can safely unbind
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    buildCubeMesh(cubeMesh);
+
+    //Instance attributes advance once per box instead of once per vertex, their pointers are set per pass in drawInstances
+    glBindVertexArray(cubeMesh.VAO);
+    for (unsigned int attribute{ 1 }; attribute <= 3; attribute++)
+    {
+        glEnableVertexAttribArray(attribute);
+        glVertexAttribDivisor(attribute, 1);
+    }
 
     //Unbind
     glBindVertexArray(0);
 }
 
-void drawPlatform(glm::mat4& model, Shader& ourShader)
-{
-    ourShader.setVec3("boxColor", platformColor);
-    model = glm::translate(glm::mat4(1.0f), platformPosition);
-    model = glm::scale(model, glm::vec3(platformScale, 0.5f, platformScale));
-    ourShader.setMat4("model", model);
-    glDrawArrays(GL_TRIANGLES, 0, 36);
-}
-
-void drawSnake(glm::mat4& model, Shader& ourShader, Snake& snake)
+void addPlatformInstance(std::vector<BoxInstance>& instances)
 {
-    ourShader.setVec3("boxColor", snakeColor);
-    for (auto &segment : snake.snakeBody)
-    {
-        glm::vec3 segmentPosition{};
-        model = glm::mat4(1.0f);
-        if (segment.direction == MOVING_UP || segment.direction == MOVING_DOWN)
-        {
-            float xScale{ std::abs(segment.frontCoord.first - segment.backCoord.first) };
-            segmentPosition.x = (segment.frontCoord.first + segment.backCoord.first)/2;
-            segmentPosition.y = 0.5f;
-            segmentPosition.z = segment.frontCoord.second;
-            model = glm::translate(model, segmentPosition);
-            model = glm::scale(model, glm::vec3(xScale, 0.25f, 0.25f));
-        }
-        else if (segment.direction == MOVING_LEFT || segment.direction == MOVING_RIGHT)
-        {
-            float zScale{ std::abs(segment.frontCoord.second - segment.backCoord.second) };
-            segmentPosition.x = segment.frontCoord.first;
-            segmentPosition.y = 0.5f;
-            segmentPosition.z = (segment.frontCoord.second + segment.backCoord.second) / 2;
-            model = glm::translate(model, segmentPosition);
-            model = glm::scale(model, glm::vec3(0.25f, 0.25f, zScale));
-        }
-        ourShader.setMat4("model", model);
-        glDrawArrays(GL_TRIANGLES, 0, 36);
-    }
+    instances.push_back(BoxInstance{ platformPosition, glm::vec3(platformScale, 0.5f, platformScale), platformColor });
 }
 
-void drawFood(glm::mat4& model, Shader& ourShader, std::vector<std::pair<float, float>>& foodContainer)
+void addFoodInstances(std::vector<BoxInstance>& instances, std::vector<std::pair<float, float>>& foodContainer)
 {
     for (auto& foodPiece : foodContainer)
-    {
-        ourShader.setVec3("boxColor", foodColor);
-        model = glm::translate(glm::mat4(1.0f), glm::vec3{foodPiece.first, 0.5f, foodPiece.second});
-        model = glm::scale(model, glm::vec3(0.25f, 0.25f, 0.25f));
-        ourShader.setMat4("model", model);
-        glDrawArrays(GL_TRIANGLES, 0, 36);
-    }
-}
-
-void moveSnake(Snake& snake)
-{
-    float snakeLength{ getSnakeLength(snake) };
-    if (snake.currentDirection != snake.snakeBody[0].direction)
-    {
-        addSegment(snake);
-        handleMovement(snake, !(snakeLength < snake.length));
-    }
-    else
-    {
-        handleMovement(snake, !(snakeLength < snake.length));
-    }
+        instances.push_back(BoxInstance{ glm::vec3{foodPiece.first, 0.5f, foodPiece.second}, glm::vec3(0.25f, 0.25f, 0.25f), foodColor });
 }
 
-void handleMovement(Snake& snake, bool moveBack)
+//Grid mode moves a whole cell per move, so cells are drawn where they are without interpolating
+void addGridSnakeInstances(std::vector<BoxInstance>& instances, GridWorld& gridWorld)
 {
-    switch (snake.snakeBody[0].direction)
+    for (std::uint32_t cell : gridWorld.snake.body)
     {
-        case MOVING_UP:
-            snake.snakeBody[0].frontCoord.first -= snakeMovespeed * deltaTime;
-            break;
-        case MOVING_DOWN:
-            snake.snakeBody[0].frontCoord.first += snakeMovespeed * deltaTime;
-            break;
-        case MOVING_LEFT:
-            snake.snakeBody[0].frontCoord.second += snakeMovespeed * deltaTime;
-            break;
-        case MOVING_RIGHT:
-            snake.snakeBody[0].frontCoord.second -= snakeMovespeed * deltaTime;
-            break;
+        std::pair<float, float> center{ getCellCenter(gridWorld, cell) };
+        instances.push_back(BoxInstance{ glm::vec3{center.first, 0.5f, center.second}, glm::vec3(gridCellSize, 0.25f, gridCellSize), snakeColor });
     }
-
-    if (moveBack)
-    {       
-        std::size_t numSegments{ snake.snakeBody.size() - 1 };
-        float distanceIncrement = snakeMovespeed * deltaTime;
-        //Check if snake movement deletes a segment
-        if (snake.snakeBody[numSegments].direction == MOVING_UP || snake.snakeBody[numSegments].direction == MOVING_DOWN)
-        {
-            float currentSegmentLength{ getSegmentLength(snake.snakeBody[numSegments], true) };
-            if (distanceIncrement >= currentSegmentLength)
-            {
-                snake.snakeBody.pop_back();
-                distanceIncrement -= currentSegmentLength;
-            }
-        }
-        else
-        {
-            float currentSegmentLength{ getSegmentLength(snake.snakeBody[numSegments], false) };
-            if (distanceIncrement >= currentSegmentLength)
-            {
-                snake.snakeBody.pop_back();
-                distanceIncrement -= currentSegmentLength;
-            }
-        }
-
-        numSegments = snake.snakeBody.size() - 1;
-        switch (snake.snakeBody[numSegments].direction)
-        {
-            case MOVING_UP:
-                snake.snakeBody[numSegments].backCoord.first -= distanceIncrement;
-                break;
-            case MOVING_DOWN:
-                snake.snakeBody[numSegments].backCoord.first += distanceIncrement;
-                break;
-            case MOVING_LEFT:
-                snake.snakeBody[numSegments].backCoord.second += distanceIncrement;
-                break;
-            case MOVING_RIGHT:
-                snake.snakeBody[numSegments].backCoord.second -= distanceIncrement;
-                break;
-        } 
-    }        
 }
 
-float getSnakeLength(Snake& snake)
+void addGridFoodInstances(std::vector<BoxInstance>& instances, GridWorld& gridWorld)
 {
-    float totalLength{ 0 };
-    for (auto& segment : snake.snakeBody)
+    for (std::uint32_t cell : gridWorld.foodContainer)
     {
-        if (segment.direction == MOVING_UP || segment.direction == MOVING_DOWN)
-            totalLength += getSegmentLength(segment, true);
-        else if (segment.direction == MOVING_LEFT || segment.direction == MOVING_RIGHT)
-            totalLength += getSegmentLength(segment, false);
+        std::pair<float, float> center{ getCellCenter(gridWorld, cell) };
+        instances.push_back(BoxInstance{ glm::vec3{center.first, 0.5f, center.second}, glm::vec3(0.25f, 0.25f, 0.25f), foodColor });
     }
-    return totalLength;
-}
-
-float getSegmentLength(SnakeSegment& snakeSegment, bool inX)
-{
-    if(inX)
-        return std::abs(snakeSegment.frontCoord.first - snakeSegment.backCoord.first);
-    return std::abs(snakeSegment.frontCoord.second - snakeSegment.backCoord.second);
 }
 
-void addSegment(Snake& snake)
+//Returns the byte offset of this frame's instances in the stream, the draws read them from there
+std::size_t uploadInstances(RenderState& renderState, StreamBuffer& instanceStream, std::vector<BoxInstance>& instances)
 {
-    std::pair<float, float> headCoord{ snake.snakeBody[0].frontCoord };  
-    switch (snake.snakeBody[0].direction)
-    { 
-        case MOVING_UP:
-            switch (snake.currentDirection)
-            {
-                case MOVING_LEFT:
-                    snake.snakeBody[0].frontCoord.first += 2*snakeRadius;
-                    snake.snakeBody.insert(snake.snakeBody.begin(), SnakeSegment{ {headCoord.first + snakeRadius, headCoord.second + snakeRadius},{headCoord.first + snakeRadius, headCoord.second - snakeRadius},MOVING_LEFT });
-                    break;
-                case MOVING_RIGHT:
-                    snake.snakeBody[0].frontCoord.first += 2 * snakeRadius;
-                    snake.snakeBody.insert(snake.snakeBody.begin(), SnakeSegment{ {headCoord.first + snakeRadius, headCoord.second - snakeRadius},{headCoord.first + snakeRadius, headCoord.second + snakeRadius},MOVING_RIGHT });
-                    break;
-                case MOVING_DOWN:
-                    snake.currentDirection = snake.snakeBody[0].direction;
-                    break;
-            }
-            break;
-        case MOVING_DOWN:
-            switch (snake.currentDirection)
-            {
-                case MOVING_LEFT:
-                    snake.snakeBody[0].frontCoord.first -= 2 * snakeRadius;
-                    snake.snakeBody.insert(snake.snakeBody.begin(), SnakeSegment{ {headCoord.first - snakeRadius, headCoord.second + snakeRadius},{headCoord.first - snakeRadius, headCoord.second - snakeRadius},MOVING_LEFT });
-                    break;
-                case MOVING_RIGHT:
-                    snake.snakeBody[0].frontCoord.first -= 2 * snakeRadius;
-                    snake.snakeBody.insert(snake.snakeBody.begin(), SnakeSegment{ {headCoord.first - snakeRadius, headCoord.second - snakeRadius},{headCoord.first - snakeRadius, headCoord.second + snakeRadius},MOVING_RIGHT });
-                    break;
-                case MOVING_UP:
-                    snake.currentDirection = snake.snakeBody[0].direction;
-                    break;
-            }
-            break;
-        case MOVING_LEFT:
-            switch (snake.currentDirection)
-            {
-                case MOVING_UP:
-                    snake.snakeBody[0].frontCoord.second -= 2 * snakeRadius;
-                    snake.snakeBody.insert(snake.snakeBody.begin(), SnakeSegment{ {headCoord.first - snakeRadius, headCoord.second - snakeRadius},{headCoord.first + snakeRadius, headCoord.second - snakeRadius},MOVING_UP });
-                    break;
-                case MOVING_DOWN:
-                    snake.snakeBody[0].frontCoord.second -= 2 * snakeRadius;
-                    snake.snakeBody.insert(snake.snakeBody.begin(), SnakeSegment{ {headCoord.first + snakeRadius, headCoord.second - snakeRadius},{headCoord.first - snakeRadius, headCoord.second - snakeRadius},MOVING_DOWN });
-                    break;
-                case MOVING_RIGHT:
-                    snake.currentDirection = snake.snakeBody[0].direction;
-                    break;
-            }
-            break;
-        case MOVING_RIGHT:
-            switch (snake.currentDirection)
-            {
-                case MOVING_UP:
-                    snake.snakeBody[0].frontCoord.second += 2 * snakeRadius;
-                    snake.snakeBody.insert(snake.snakeBody.begin(), SnakeSegment{ {headCoord.first - snakeRadius, headCoord.second + snakeRadius},{headCoord.first + snakeRadius, headCoord.second + snakeRadius},MOVING_UP });
-                    break;
-                case MOVING_DOWN:
-                    snake.snakeBody[0].frontCoord.second += 2 * snakeRadius;
-                    snake.snakeBody.insert(snake.snakeBody.begin(), SnakeSegment{ {headCoord.first + snakeRadius, headCoord.second + snakeRadius},{headCoord.first - snakeRadius, headCoord.second + snakeRadius},MOVING_DOWN });
-                    break;
-                case MOVING_LEFT:
-                    snake.currentDirection = snake.snakeBody[0].direction;
-                    break;
-            }
-            break;
-    }
+    return writeStreamBuffer(instanceStream, renderState, instances.data(), instances.size() * sizeof(BoxInstance));
 }
 
-void handleCollisions(GLFWwindow* window, Snake& snake, std::vector<std::pair<float, float>>& foodContainer)
+//GL 3.3 has no base instance, so each pass points the instance attributes at its own slice of the buffer
+void drawInstances(RenderState& renderState, const Mesh& mesh, StreamBuffer& instanceStream, std::size_t streamOffset, std::size_t first, std::size_t count)
 {
-    //Platform Collision
-    if (snake.snakeBody[0].frontCoord.first > (platformPosition.x + (platformScale * 0.5)) || snake.snakeBody[0].frontCoord.first < (platformPosition.x - (platformScale * 0.5)))
-        glfwSetWindowShouldClose(window, true);
-    if (snake.snakeBody[0].frontCoord.second > (platformPosition.z + (platformScale * 0.5)) || snake.snakeBody[0].frontCoord.second < (platformPosition.z - (platformScale * 0.5)))
-        glfwSetWindowShouldClose(window, true);
-
-    //Self Collision
-    for (int i{ 2 }; i < snake.snakeBody.size(); i++)
-    {
-        if(checkCollision(snake.snakeBody[0], snake.snakeBody[i]))
-            glfwSetWindowShouldClose(window, true);
-    }
-
-    //Food Collision
-    for (int i{ 0 }; i < foodContainer.size(); i++)
-    {
-        if (checkFoodCollision(snake.snakeBody[0], foodContainer[i]))
-        {
-            snake.length += 2 * snakeRadius;
-            foodContainer.erase(foodContainer.begin() + i);
-            break;
-        }       
-    }
+    if (count == 0)
+        return;
+
+    //Attribute pointers are VAO state, so the mesh's VAO has to be bound before they are set
+    std::size_t base{ streamOffset + first * sizeof(BoxInstance) };
+    bindVertexArray(renderState, mesh.VAO);
+    bindBuffer(renderState, GL_ARRAY_BUFFER, instanceStream.buffer);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(BoxInstance), (void*)(base + offsetof(BoxInstance, position)));
+    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(BoxInstance), (void*)(base + offsetof(BoxInstance, scale)));
+    glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(BoxInstance), (void*)(base + offsetof(BoxInstance, color)));
+    drawMeshInstanced(renderState, mesh, static_cast<GLsizei>(count));
 }
 
-bool checkCollision(SnakeSegment& frontSegment, SnakeSegment& segment)
+void initCameraBuffer(unsigned int& cameraUBO)
 {
-    float x1{};
-    float x2{};
-    float z1{};
-    float z2{};
-    setBoundsFromSegment(x1, x2, z1, z2, segment);
-
-    if (frontSegment.direction == MOVING_DOWN || frontSegment.direction == MOVING_UP)
-    {
-        //Pair for each leading corner
-        std::pair<float, float> pair1{ frontSegment.frontCoord.first, frontSegment.frontCoord.second + snakeRadius };
-        std::pair<float, float> pair2{ frontSegment.frontCoord.first, frontSegment.frontCoord.second - snakeRadius };
-        return(inBox(x1, x2, z1, z2, pair1) || inBox(x1, x2, z1, z2, pair2));
-    }
-    else
-    {
-        //Pair for each leading corner
-        std::pair<float, float> pair1{ frontSegment.frontCoord.first + snakeRadius, frontSegment.frontCoord.second };
-        std::pair<float, float> pair2{ frontSegment.frontCoord.first - snakeRadius, frontSegment.frontCoord.second };
-        return(inBox(x1, x2, z1, z2, pair1) || inBox(x1, x2, z1, z2, pair2));
-    }
+    //std140 layout: view at offset 0, projection at offset 64
+    glGenBuffers(1, &cameraUBO);
+    glBindBuffer(GL_UNIFORM_BUFFER, cameraUBO);
+    glBufferData(GL_UNIFORM_BUFFER, 2 * sizeof(glm::mat4), NULL, GL_DYNAMIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, cameraBlockBinding, cameraUBO);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
 }
 
-bool inBox(float x1, float x2, float z1, float z2, std::pair<float, float>& point)
+//GL 3.3 has no binding layout qualifier, so each program's block is attached to the binding point here
+void bindCameraBlock(unsigned int programID)
 {
-    return (((x1 < point.first) && (point.first < x2)) && ((z1 < point.second) && (point.second < z2)));
+    unsigned int blockIndex{ glGetUniformBlockIndex(programID, "CameraBlock") };
+    if (blockIndex != GL_INVALID_INDEX)
+        glUniformBlockBinding(programID, blockIndex, cameraBlockBinding);
 }
 
-bool checkFoodCollision(SnakeSegment& frontSegment, std::pair<float,float>& foodCoords)
+void updateCameraBuffer(RenderState& renderState, unsigned int cameraUBO, glm::mat4& uploadedView, bool& viewUploaded)
 {
-    float x1{ foodCoords.first - snakeRadius };
-    float x2{ foodCoords.first + snakeRadius };
-    float z1{ foodCoords.second - snakeRadius };
-    float z2{ foodCoords.second + snakeRadius };
-    if (frontSegment.direction == MOVING_DOWN || frontSegment.direction == MOVING_UP)
-    {
-        //Pair for each leading corner
-        std::pair<float, float> pair1{ frontSegment.frontCoord.first, frontSegment.frontCoord.second + snakeRadius };
-        std::pair<float, float> pair2{ frontSegment.frontCoord.first, frontSegment.frontCoord.second - snakeRadius };
-        return(inBox(x1, x2, z1, z2, pair1) || inBox(x1, x2, z1, z2, pair2));
-    }
-    else
+    glm::mat4 view{ camera.getViewMatrix() };
+    bool viewDirty{ !viewUploaded || view != uploadedView };
+    //A minimised window reports a zero sized framebuffer, keep the old projection until it comes back
+    bool projectionReady{ projectionDirty && framebufferWidth > 0 && framebufferHeight > 0 };
+    if (!viewDirty)
+        countSkippedCall(renderState);
+    if (!viewDirty && !projectionReady)
+        return;
+
+    //The uniform buffer stays bound afterwards, renderState knows about it so the next upload skips the bind
+    bindBuffer(renderState, GL_UNIFORM_BUFFER, cameraUBO);
+    if (viewDirty)
     {
-        //Pair for each leading corner
-        std::pair<float, float> pair1{ frontSegment.frontCoord.first + snakeRadius, frontSegment.frontCoord.second };
-        std::pair<float, float> pair2{ frontSegment.frontCoord.first - snakeRadius, frontSegment.frontCoord.second };
-        return(inBox(x1, x2, z1, z2, pair1) || inBox(x1, x2, z1, z2, pair2));
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(glm::mat4), glm::value_ptr(view));
+        uploadedView = view;
+        viewUploaded = true;
     }
-}
-
-void addFood(Snake& snake, std::vector<std::pair<float, float>>& foodContainer)
-{
-    unsigned int seed{ static_cast<unsigned int>(std::chrono::system_clock::now().time_since_epoch().count()) };
-    std::minstd_rand randomGen{ seed };
-    float sample{ static_cast<float>(randomGen()) };
-    sample = (platformScale * (sample / randomGen.max()) - (platformScale / 2)) * ((platformScale - (2 * snakeRadius)) / (platformScale));
-    float xCoord{ sample };
-    sample = static_cast<float>(randomGen());
-    sample = (platformScale * (sample / randomGen.max()) - (platformScale / 2)) * ((platformScale - (2 * snakeRadius)) / (platformScale));
-    float yCoord{ sample };
-
-    bool invalidPlacement{ false };
-    //Check if valid placement position
-    for (SnakeSegment& segment : snake.snakeBody)
+    if (projectionReady)
     {
-        std::pair<float, float> tempCoord{};
-        float x1{};
-        float x2{};
-        float z1{};
-        float z2{};
-        setBoundsFromSegment(x1, x2, z1, z2, segment);
-        //Now check each of the four corners
-        tempCoord = { xCoord + snakeRadius, yCoord + snakeRadius };
-        if (inBox(x1, x2, z1, z2, tempCoord))
-        {
-            invalidPlacement = true;
-            break;
-        }
-        tempCoord = { xCoord + snakeRadius, yCoord - snakeRadius };
-        if (inBox(x1, x2, z1, z2, tempCoord))
-        {
-            invalidPlacement = true;
-            break;
-        }
-        tempCoord = { xCoord - snakeRadius, yCoord + snakeRadius };
-        if (inBox(x1, x2, z1, z2, tempCoord))
-        {
-            invalidPlacement = true;
-            break;
-        }
-        tempCoord = { xCoord - snakeRadius, yCoord - snakeRadius };
-        if (inBox(x1, x2, z1, z2, tempCoord))
-        {
-            invalidPlacement = true;
-            break;
-        }
+        //Height stays fixed and width follows the aspect ratio, 800x600 gives the original -4..4 by -3..3 view
+        float viewHalfWidth{ viewHalfHeight * static_cast<float>(framebufferWidth) / static_cast<float>(framebufferHeight) };
+        glm::mat4 projection{ glm::ortho(-viewHalfWidth, viewHalfWidth, -viewHalfHeight, viewHalfHeight, 0.1f, 100.0f) };
+        glBufferSubData(GL_UNIFORM_BUFFER, sizeof(glm::mat4), sizeof(glm::mat4), glm::value_ptr(projection));
+        projectionDirty = false;
     }
-    
-    if(!invalidPlacement)
-        foodContainer.push_back(std::pair<float, float>{ xCoord, sample });
 }
-
-void setBoundsFromSegment(float& x1, float& x2, float& z1, float& z2, SnakeSegment& segment)
-{
-    switch (segment.direction)
-    {
-        case MOVING_UP:
-            x1 = segment.frontCoord.first;
-            x2 = segment.backCoord.first;
-            z1 = segment.frontCoord.second - snakeRadius;
-            z2 = segment.frontCoord.second + snakeRadius;
-            break;
-        case MOVING_DOWN:
-            x1 = segment.backCoord.first;
-            x2 = segment.frontCoord.first;
-            z1 = segment.frontCoord.second - snakeRadius;
-            z2 = segment.frontCoord.second + snakeRadius;
-            break;
-        case MOVING_LEFT:
-            x1 = segment.frontCoord.first - snakeRadius;
-            x2 = segment.frontCoord.first + snakeRadius;
-            z1 = segment.backCoord.second;
-            z2 = segment.frontCoord.second;
-            break;
-        case MOVING_RIGHT:
-            x1 = segment.frontCoord.first - snakeRadius;
-            x2 = segment.frontCoord.first + snakeRadius;
-            z1 = segment.frontCoord.second;
-            z2 = segment.backCoord.second;
-            break;
-    }
-}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#include "Mesh.h"
+
+void initMesh(Mesh& mesh, const float* positions, std::size_t vertexCount, const unsigned short* indices, std::size_t indexCount)
+{
+    glGenVertexArrays(1, &mesh.VAO);
+    glGenBuffers(1, &mesh.VBO);
+    glGenBuffers(1, &mesh.EBO);
+
+    //The element buffer binding is VAO state, so the VAO has to be bound first and unbound before the EBO is
+    glBindVertexArray(mesh.VAO);
+
+    glBindBuffer(GL_ARRAY_BUFFER, mesh.VBO);
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCount * 3 * sizeof(float)), positions, GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indexCount * sizeof(unsigned short)), indices, GL_STATIC_DRAW);
+
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    mesh.indexCount = static_cast<GLsizei>(indexCount);
+}
+
+void deleteMesh(Mesh& mesh)
+{
+    glDeleteVertexArrays(1, &mesh.VAO);
+    glDeleteBuffers(1, &mesh.VBO);
+    glDeleteBuffers(1, &mesh.EBO);
+    mesh = Mesh{};
+}
+
+void buildCubeMesh(Mesh& mesh)
+{
+    //Corner i has x, y and z set from bits 0, 1 and 2 of i
+    const float positions[] = {
+    -0.5f, -0.5f, -0.5f,
+     0.5f, -0.5f, -0.5f,
+    -0.5f,  0.5f, -0.5f,
+     0.5f,  0.5f, -0.5f,
+    -0.5f, -0.5f,  0.5f,
+     0.5f, -0.5f,  0.5f,
+    -0.5f,  0.5f,  0.5f,
+     0.5f,  0.5f,  0.5f
+    };
+    const unsigned short indices[] = {
+    2, 3, 1, 2, 1, 0, //-Z
+    4, 5, 7, 4, 7, 6, //+Z
+    4, 6, 2, 4, 2, 0, //-X
+    1, 3, 7, 1, 7, 5, //+X
+    0, 1, 5, 0, 5, 4, //-Y
+    6, 7, 3, 6, 3, 2  //+Y
+    };
+    initMesh(mesh, positions, 8, indices, sizeof(indices) / sizeof(indices[0]));
+}
+
+void drawMeshInstanced(RenderState& renderState, const Mesh& mesh, GLsizei instanceCount)
+{
+    bindVertexArray(renderState, mesh.VAO);
+    glDrawElementsInstanced(GL_TRIANGLES, mesh.indexCount, GL_UNSIGNED_SHORT, (void*)0, instanceCount);
+}
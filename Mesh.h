@@ -0,0 +1,29 @@
+//Indexed triangle meshes, one VAO with its vertex and element buffers per mesh
+
+#ifndef MESH_H
+#define MESH_H
+
+#include <glad/glad.h>
+
+#include <cstddef>
+
+#include "RenderState.h"
+
+//Vertices are tightly packed xyz positions on attribute 0, the other attribute slots are left to the caller
+struct Mesh
+{
+    unsigned int VAO{ 0 };
+    unsigned int VBO{ 0 };
+    unsigned int EBO{ 0 };
+    GLsizei indexCount{ 0 };
+};
+
+void initMesh(Mesh& mesh, const float* positions, std::size_t vertexCount, const unsigned short* indices, std::size_t indexCount);
+void deleteMesh(Mesh& mesh);
+
+//Unit cube centred on the origin, 8 shared corners and counter-clockwise outward faces so back faces can be culled
+void buildCubeMesh(Mesh& mesh);
+
+void drawMeshInstanced(RenderState& renderState, const Mesh& mesh, GLsizei instanceCount);
+
+#endif
@@ -0,0 +1,57 @@
+//One bit per board cell packed 64 to a word, so an occupancy test is a shift and a mask
+
+#ifndef OCCUPANCY_BITSET_H
+#define OCCUPANCY_BITSET_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+class OccupancyBitset
+{
+public:
+    OccupancyBitset() = default;
+    explicit OccupancyBitset(std::size_t bits) { resize(bits); }
+
+    //Clears every bit as well, the contents are not kept
+    void resize(std::size_t bits)
+    {
+        bitCount = bits;
+        words.assign((bits + 63) / 64, 0);
+    }
+
+    void clear() { words.assign(words.size(), 0); }
+
+    std::size_t size() const { return bitCount; }
+    std::size_t wordCount() const { return words.size(); }
+    std::uint64_t word(std::size_t i) const { return words[i]; }
+
+    bool test(std::uint32_t bit) const { return (words[bit >> 6] >> (bit & 63)) & 1; }
+    void set(std::uint32_t bit) { words[bit >> 6] |= std::uint64_t{ 1 } << (bit & 63); }
+    void reset(std::uint32_t bit) { words[bit >> 6] &= ~(std::uint64_t{ 1 } << (bit & 63)); }
+
+    //Bits past size() in the last word, which are never set and must not be counted as free cells
+    std::uint64_t unusedMask() const
+    {
+        std::size_t usedBits{ bitCount & 63 };
+        return usedBits == 0 ? 0 : ~std::uint64_t{ 0 } << usedBits;
+    }
+
+private:
+    std::vector<std::uint64_t> words{};
+    std::size_t bitCount{ 0 };
+};
+
+inline int countBits(std::uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(value);
+#else
+    int count{ 0 };
+    for (; value != 0; value &= value - 1)
+        ++count;
+    return count;
+#endif
+}
+
+#endif
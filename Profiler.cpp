@@ -0,0 +1,103 @@
+#include "Profiler.h"
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+struct StageSamples
+{
+    std::vector<std::uint64_t> window = std::vector<std::uint64_t>(profileWindowSize);
+    std::size_t next{ 0 };
+    std::uint64_t count{ 0 };
+    std::uint64_t totalNanoseconds{ 0 };
+    std::uint64_t maxNanoseconds{ 0 };
+};
+
+const char* const stageNames[PROFILE_STAGE_COUNT]{
+    "frame", "input", "simulation", "food", "move", "collisions", "autopilot", "camera", "gather", "upload", "draw", "swap", "gpu_platform", "gpu_snake", "gpu_food"
+};
+
+//Allocated on a thread's first sample, threads that never profile pay nothing
+static StageSamples* getStageSamples()
+{
+    thread_local std::vector<StageSamples> stages(PROFILE_STAGE_COUNT);
+    return stages.data();
+}
+
+void recordProfileSample(ProfileStage stage, std::uint64_t nanoseconds)
+{
+    StageSamples& samples{ getStageSamples()[stage] };
+    samples.window[samples.next] = nanoseconds;
+    samples.next = (samples.next + 1) % profileWindowSize;
+    samples.count++;
+    samples.totalNanoseconds += nanoseconds;
+    samples.maxNanoseconds = std::max(samples.maxNanoseconds, nanoseconds);
+}
+
+static double getPercentileMs(std::vector<std::uint64_t>& sorted, double percentile)
+{
+    std::size_t rank{ static_cast<std::size_t>(percentile * static_cast<double>(sorted.size() - 1) + 0.5) };
+    return static_cast<double>(sorted[rank]) / 1.0e6;
+}
+
+StageSummary summarizeStage(ProfileStage stage)
+{
+    StageSamples& samples{ getStageSamples()[stage] };
+    StageSummary summary{};
+    summary.count = samples.count;
+    if (samples.count == 0)
+        return summary;
+
+    std::size_t windowCount{ static_cast<std::size_t>(std::min<std::uint64_t>(samples.count, profileWindowSize)) };
+    std::vector<std::uint64_t> sorted(samples.window.begin(), samples.window.begin() + windowCount);
+    std::sort(sorted.begin(), sorted.end());
+
+    summary.meanMs = static_cast<double>(samples.totalNanoseconds) / static_cast<double>(samples.count) / 1.0e6;
+    summary.p50Ms = getPercentileMs(sorted, 0.50);
+    summary.p99Ms = getPercentileMs(sorted, 0.99);
+    summary.maxMs = static_cast<double>(samples.maxNanoseconds) / 1.0e6;
+    return summary;
+}
+
+const char* getProfileStageName(ProfileStage stage)
+{
+    return stageNames[stage];
+}
+
+bool writeProfileReport(const std::string& path)
+{
+    std::ofstream file{ path };
+    if (!file)
+        return false;
+
+    bool csv{ path.size() >= 4 && path.compare(path.size() - 4, 4, ".csv") == 0 };
+    if (csv)
+        file << "stage,count,mean_ms,p50_ms,p99_ms,max_ms\n";
+    else
+        file << "{\n  \"window\": " << profileWindowSize << ",\n  \"stages\": [\n";
+
+    bool first{ true };
+    for (int i{ 0 }; i < PROFILE_STAGE_COUNT; i++)
+    {
+        ProfileStage stage{ static_cast<ProfileStage>(i) };
+        StageSummary summary{ summarizeStage(stage) };
+        if (summary.count == 0)
+            continue;
+
+        if (csv)
+        {
+            file << getProfileStageName(stage) << ',' << summary.count << ',' << summary.meanMs << ','
+                << summary.p50Ms << ',' << summary.p99Ms << ',' << summary.maxMs << '\n';
+        }
+        else
+        {
+            file << (first ? "" : ",\n") << "    { \"stage\": \"" << getProfileStageName(stage) << "\", \"count\": " << summary.count
+                << ", \"mean_ms\": " << summary.meanMs << ", \"p50_ms\": " << summary.p50Ms
+                << ", \"p99_ms\": " << summary.p99Ms << ", \"max_ms\": " << summary.maxMs << " }";
+        }
+        first = false;
+    }
+    if (!csv)
+        file << "\n  ]\n}\n";
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,77 @@
+//Scoped CPU timers for the stages of a frame, compiled in only when SNAKE_PROFILE is defined
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+enum ProfileStage
+{
+    PROFILE_FRAME,
+    PROFILE_INPUT,
+    PROFILE_SIMULATION,
+    PROFILE_FOOD,
+    PROFILE_MOVE,
+    PROFILE_COLLISIONS,
+    PROFILE_AUTOPILOT,
+    PROFILE_CAMERA,
+    PROFILE_GATHER,
+    PROFILE_UPLOAD,
+    PROFILE_DRAW,
+    PROFILE_SWAP,
+    PROFILE_GPU_PLATFORM,
+    PROFILE_GPU_SNAKE,
+    PROFILE_GPU_FOOD,
+    PROFILE_STAGE_COUNT
+};
+
+//Percentiles are taken over the most recent profileWindowSize samples of each stage
+const std::size_t profileWindowSize{ 1024 };
+
+struct StageSummary
+{
+    std::uint64_t count{ 0 }; //Every sample ever taken, not just the window
+    double meanMs{ 0.0 };
+    double p50Ms{ 0.0 };
+    double p99Ms{ 0.0 };
+    double maxMs{ 0.0 };
+};
+
+//Samples are kept per thread, so headless batch games stepping on workers never contend with the render thread
+void recordProfileSample(ProfileStage stage, std::uint64_t nanoseconds);
+StageSummary summarizeStage(ProfileStage stage);
+const char* getProfileStageName(ProfileStage stage);
+
+//Writes every stage's summary for the calling thread, CSV if path ends in .csv and JSON otherwise
+bool writeProfileReport(const std::string& path);
+
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(ProfileStage stage) : stage{ stage }, start{ std::chrono::steady_clock::now() } {}
+    ~ScopedTimer()
+    {
+        auto elapsed{ std::chrono::steady_clock::now() - start };
+        recordProfileSample(stage, static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    ProfileStage stage{};
+    std::chrono::steady_clock::time_point start{};
+};
+
+#define PROFILE_JOIN_NAME(name, line) name##line
+#define PROFILE_TIMER_NAME(name, line) PROFILE_JOIN_NAME(name, line)
+
+#ifdef SNAKE_PROFILE
+#define PROFILE_SCOPE(stage) ScopedTimer PROFILE_TIMER_NAME(profileTimer, __LINE__){ stage }
+#else
+#define PROFILE_SCOPE(stage) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,74 @@
+#include "RenderState.h"
+
+static void countCall(RenderState& state, bool issued)
+{
+    if (issued)
+        state.frameStats.issued++;
+    else
+        state.frameStats.avoided++;
+}
+
+void useProgram(RenderState& state, unsigned int program)
+{
+    bool changed{ state.program != program };
+    if (changed)
+    {
+        glUseProgram(program);
+        state.program = program;
+    }
+    countCall(state, changed);
+}
+
+void bindVertexArray(RenderState& state, unsigned int vertexArray)
+{
+    bool changed{ state.vertexArray != vertexArray };
+    if (changed)
+    {
+        glBindVertexArray(vertexArray);
+        state.vertexArray = vertexArray;
+    }
+    countCall(state, changed);
+}
+
+//Only the generic binding points the renderer uses are tracked, anything else is passed straight through
+void bindBuffer(RenderState& state, GLenum target, unsigned int buffer)
+{
+    unsigned int* bound{ NULL };
+    if (target == GL_ARRAY_BUFFER)
+        bound = &state.arrayBuffer;
+    else if (target == GL_UNIFORM_BUFFER)
+        bound = &state.uniformBuffer;
+
+    bool changed{ bound == NULL || *bound != buffer };
+    if (changed)
+    {
+        glBindBuffer(target, buffer);
+        if (bound != NULL)
+            *bound = buffer;
+    }
+    countCall(state, changed);
+}
+
+//Deleting a buffer unbinds it, and GL may hand the same name out again, so the shadow has to drop it too
+void forgetBuffer(RenderState& state, unsigned int buffer)
+{
+    if (state.arrayBuffer == buffer)
+        state.arrayBuffer = 0;
+    if (state.uniformBuffer == buffer)
+        state.uniformBuffer = 0;
+}
+
+//For uploads the caller skipped itself because the data on the GPU was already current
+void countSkippedCall(RenderState& state)
+{
+    countCall(state, false);
+}
+
+//Folds the frame's counters into the running totals and starts a new frame
+void endRenderFrame(RenderState& state)
+{
+    state.totalStats.issued += state.frameStats.issued;
+    state.totalStats.avoided += state.frameStats.avoided;
+    state.frameStats = RenderStats{};
+    state.frames++;
+}
@@ -0,0 +1,33 @@
+//Shadow copy of the GL state the renderer touches, so redundant binds never reach the driver
+
+#ifndef RENDER_STATE_H
+#define RENDER_STATE_H
+
+#include <glad/glad.h>
+
+//GL calls that went through to the driver and ones that were skipped because the state already matched
+struct RenderStats
+{
+    unsigned long long issued{ 0 };
+    unsigned long long avoided{ 0 };
+};
+
+struct RenderState
+{
+    unsigned int program{ 0 };
+    unsigned int vertexArray{ 0 };
+    unsigned int arrayBuffer{ 0 };
+    unsigned int uniformBuffer{ 0 };
+    RenderStats frameStats{};
+    RenderStats totalStats{};
+    unsigned long long frames{ 0 };
+};
+
+void useProgram(RenderState& state, unsigned int program);
+void bindVertexArray(RenderState& state, unsigned int vertexArray);
+void bindBuffer(RenderState& state, GLenum target, unsigned int buffer);
+void forgetBuffer(RenderState& state, unsigned int buffer);
+void countSkippedCall(RenderState& state);
+void endRenderFrame(RenderState& state);
+
+#endif
@@ -0,0 +1,150 @@
+//Converts recorded text input logs into binary replays and verifies binary replays against the simulation
+//  SnakeReplay convert <input log> <replay file>
+//  SnakeReplay verify <replay file>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+#include "../SnakeWorld.h"
+#include "../GameClock.h"
+#include "../InputLog.h"
+#include "../ReplayFile.h"
+
+//Re-simulates the text log and writes every direction change and food spawn as it happens
+int convertReplay(const char* inputPath, const char* outputPath)
+{
+    InputLog inputLog{};
+    if (!loadInputLog(inputLog, inputPath))
+    {
+        std::cout << "Failed to read " << inputPath << std::endl;
+        return -1;
+    }
+
+    ReplayHeader header{};
+    header.seed = inputLog.seed;
+    header.engine = inputLog.engine;
+    header.ticksPerSecond = inputLog.ticksPerSecond;
+    ReplayWriter writer{};
+    if (!openReplayWriter(writer, outputPath, header))
+    {
+        std::cout << "Failed to write " << outputPath << std::endl;
+        return -1;
+    }
+
+    SnakeWorld world{ inputLog.seed, inputLog.engine };
+    GameClock clock{ inputLog.ticksPerSecond };
+    float tickSeconds{ static_cast<float>(clock.tickSeconds) };
+    std::size_t nextEvent{ 0 };
+    while (world.stepCount < inputLog.finalTick && !world.gameOver)
+    {
+        while (nextEvent < inputLog.events.size() && inputLog.events[nextEvent].tick <= world.stepCount)
+        {
+            world.snake.currentDirection = inputLog.events[nextEvent++].direction;
+            writeReplayRecord(writer, ReplayRecord{ static_cast<ReplayRecordKind>(world.snake.currentDirection), world.stepCount });
+        }
+        world.step(tickSeconds);
+        if (world.spawnedFood)
+            writeReplayRecord(writer, ReplayRecord{ REPLAY_FOOD, world.stepCount - 1, world.spawnedFoodCoords });
+    }
+
+    std::uint64_t finalHash{ hashWorldState(world) };
+    writeReplayRecord(writer, ReplayRecord{ REPLAY_END, world.stepCount, {}, finalHash });
+    if (!closeReplayWriter(writer))
+    {
+        std::cout << "Failed to write " << outputPath << std::endl;
+        return -1;
+    }
+
+    if (world.stepCount != inputLog.finalTick || finalHash != inputLog.finalHash)
+    {
+        std::cout << "Warning: " << inputPath << " no longer reproduces its recorded final state, the replay holds the current outcome" << std::endl;
+        return 1;
+    }
+    std::cout << "Converted " << world.stepCount << " ticks to " << outputPath << std::endl;
+    return 0;
+}
+
+//Streams the replay record by record, stepping the simulation alongside and checking every spawn and the final hash
+int verifyReplay(const char* replayPath)
+{
+    ReplayReader reader{};
+    if (!openReplayReader(reader, replayPath))
+    {
+        std::cout << "Failed to open " << replayPath << " as a replay" << std::endl;
+        return -1;
+    }
+    if (!headerMatchesBoard(reader.header))
+    {
+        std::cout << "Replay was recorded with a different board configuration" << std::endl;
+        return 1;
+    }
+
+    SnakeWorld world{ reader.header.seed, reader.header.engine };
+    GameClock clock{ reader.header.ticksPerSecond };
+    float tickSeconds{ static_cast<float>(clock.tickSeconds) };
+    auto start{ std::chrono::steady_clock::now() };
+
+    ReplayRecord record{};
+    bool haveRecord{ readReplayRecord(reader, record) };
+    std::uint64_t foodSpawns{ 0 };
+    const char* failure{ NULL };
+    while (failure == NULL)
+    {
+        while (haveRecord && record.kind <= REPLAY_DIRECTION_RIGHT && record.tick == world.stepCount)
+        {
+            world.snake.currentDirection = static_cast<SnakeDirection>(record.kind);
+            haveRecord = readReplayRecord(reader, record);
+        }
+
+        if (!haveRecord)
+            failure = reader.corrupt ? "malformed record" : "replay ends without an end record";
+        else if (record.tick < world.stepCount)
+            failure = "records out of order";
+        else if (record.kind == REPLAY_END && record.tick == world.stepCount)
+            break;
+        else if (world.gameOver)
+            failure = "game ended before the end record";
+        else
+        {
+            world.step(tickSeconds);
+            bool expectFood{ record.kind == REPLAY_FOOD && record.tick == world.stepCount - 1 };
+            if (world.spawnedFood != expectFood)
+                failure = world.spawnedFood ? "unrecorded food spawn" : "recorded food spawn did not happen";
+            else if (expectFood)
+            {
+                if (world.spawnedFoodCoords != record.foodCoords)
+                    failure = "food spawned in a different place";
+                ++foodSpawns;
+                haveRecord = readReplayRecord(reader, record);
+            }
+        }
+    }
+    double seconds{ std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() };
+
+    if (failure == NULL && hashWorldState(world) != record.hash)
+        failure = "final state hash differs";
+    if (failure != NULL)
+    {
+        std::cout << "Verification failed at tick " << world.stepCount << ": " << failure << std::endl;
+        return 1;
+    }
+
+    std::cout << "Verified " << world.stepCount << " ticks, " << foodSpawns << " food spawns, " << reader.file.size() << " bytes ("
+        << static_cast<double>(reader.file.size()) / static_cast<double>(world.stepCount > 0 ? world.stepCount : 1) << " bytes/tick) in "
+        << seconds * 1000.0 << " ms" << std::endl;
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc == 4 && std::strcmp(argv[1], "convert") == 0)
+        return convertReplay(argv[2], argv[3]);
+    if (argc == 3 && std::strcmp(argv[1], "verify") == 0)
+        return verifyReplay(argv[2]);
+
+    std::cout << "Usage: SnakeReplay convert <input log> <replay file>" << std::endl;
+    std::cout << "       SnakeReplay verify <replay file>" << std::endl;
+    return -1;
+}
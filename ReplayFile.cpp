@@ -0,0 +1,272 @@
+#include "ReplayFile.h"
+
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+const char replayMagic[4]{ 'S', 'N', 'K', 'R' };
+
+static void writeBytes(ReplayWriter& writer, const unsigned char* bytes, std::size_t count)
+{
+    writer.file.write(reinterpret_cast<const char*>(bytes), static_cast<std::streamsize>(count));
+}
+
+static void writeUnsigned(ReplayWriter& writer, std::uint64_t value, std::size_t byteCount)
+{
+    unsigned char bytes[8]{};
+    for (std::size_t i{ 0 }; i < byteCount; i++)
+        bytes[i] = static_cast<unsigned char>(value >> (8 * i));
+    writeBytes(writer, bytes, byteCount);
+}
+
+static void writeFloat(ReplayWriter& writer, float value)
+{
+    std::uint32_t bits{};
+    std::memcpy(&bits, &value, sizeof(bits));
+    writeUnsigned(writer, bits, 4);
+}
+
+//LEB128, seven bits per byte with the high bit marking that more follow
+static void writeVarint(ReplayWriter& writer, std::uint64_t value)
+{
+    unsigned char bytes[10]{};
+    std::size_t count{ 0 };
+    do
+    {
+        bytes[count] = static_cast<unsigned char>(value & 0x7f);
+        value >>= 7;
+        if (value != 0)
+            bytes[count] |= 0x80;
+        ++count;
+    } while (value != 0);
+    writeBytes(writer, bytes, count);
+}
+
+bool openReplayWriter(ReplayWriter& writer, const std::string& path, const ReplayHeader& header)
+{
+    writer.file.open(path, std::ios::binary | std::ios::trunc);
+    if (!writer.file)
+        return false;
+
+    std::uint64_t tickRateBits{};
+    std::memcpy(&tickRateBits, &header.ticksPerSecond, sizeof(tickRateBits));
+
+    writeBytes(writer, reinterpret_cast<const unsigned char*>(replayMagic), sizeof(replayMagic));
+    writeUnsigned(writer, replayVersion, 2);
+    writeUnsigned(writer, static_cast<std::uint64_t>(header.engine), 1);
+    writeUnsigned(writer, 0, 1);
+    writeUnsigned(writer, header.seed, 8);
+    writeUnsigned(writer, tickRateBits, 8);
+    writeFloat(writer, header.platformScale);
+    writeFloat(writer, header.snakeRadius);
+    writeFloat(writer, header.snakeMovespeed);
+    writeUnsigned(writer, header.foodSpawnInterval, 4);
+    writer.lastTick = 0;
+    return static_cast<bool>(writer.file);
+}
+
+//Records must arrive in tick order, the delta from the previous one is what keeps them down to a byte or two
+void writeReplayRecord(ReplayWriter& writer, const ReplayRecord& record)
+{
+    writeVarint(writer, ((record.tick - writer.lastTick) << 3) | static_cast<std::uint64_t>(record.kind));
+    writer.lastTick = record.tick;
+
+    if (record.kind == REPLAY_FOOD)
+    {
+        writeFloat(writer, record.foodCoords.first);
+        writeFloat(writer, record.foodCoords.second);
+    }
+    else if (record.kind == REPLAY_END)
+        writeUnsigned(writer, record.hash, 8);
+}
+
+bool closeReplayWriter(ReplayWriter& writer)
+{
+    writer.file.flush();
+    bool written{ static_cast<bool>(writer.file) };
+    writer.file.close();
+    return written;
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+bool MappedFile::open(const std::string& path)
+{
+    close();
+#ifdef _WIN32
+    HANDLE file{ CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL) };
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    fileHandle = file;
+
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+    {
+        close();
+        return false;
+    }
+    mappingHandle = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mappingHandle == NULL)
+    {
+        close();
+        return false;
+    }
+    bytes = static_cast<const unsigned char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if (bytes == NULL)
+    {
+        close();
+        return false;
+    }
+    length = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+    int file{ ::open(path.c_str(), O_RDONLY) };
+    if (file < 0)
+        return false;
+
+    struct stat fileStat{};
+    if (fstat(file, &fileStat) != 0 || fileStat.st_size == 0)
+    {
+        ::close(file);
+        return false;
+    }
+    //The mapping keeps the file alive on its own, the descriptor is not needed past this point
+    void* mapping{ mmap(NULL, static_cast<std::size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, file, 0) };
+    ::close(file);
+    if (mapping == MAP_FAILED)
+        return false;
+    madvise(mapping, static_cast<std::size_t>(fileStat.st_size), MADV_SEQUENTIAL);
+    bytes = static_cast<const unsigned char*>(mapping);
+    length = static_cast<std::size_t>(fileStat.st_size);
+#endif
+    return true;
+}
+
+void MappedFile::close()
+{
+#ifdef _WIN32
+    if (bytes != NULL)
+        UnmapViewOfFile(bytes);
+    if (mappingHandle != NULL)
+        CloseHandle(mappingHandle);
+    if (fileHandle != NULL)
+        CloseHandle(fileHandle);
+    mappingHandle = NULL;
+    fileHandle = NULL;
+#else
+    if (bytes != NULL)
+        munmap(const_cast<unsigned char*>(bytes), length);
+#endif
+    bytes = NULL;
+    length = 0;
+}
+
+static bool readUnsigned(ReplayReader& reader, std::size_t byteCount, std::uint64_t& value)
+{
+    if (reader.file.size() - reader.offset < byteCount)
+        return false;
+
+    value = 0;
+    const unsigned char* bytes{ reader.file.data() + reader.offset };
+    for (std::size_t i{ 0 }; i < byteCount; i++)
+        value |= static_cast<std::uint64_t>(bytes[i]) << (8 * i);
+    reader.offset += byteCount;
+    return true;
+}
+
+static bool readFloat(ReplayReader& reader, float& value)
+{
+    std::uint64_t bits{};
+    if (!readUnsigned(reader, 4, bits))
+        return false;
+    std::uint32_t floatBits{ static_cast<std::uint32_t>(bits) };
+    std::memcpy(&value, &floatBits, sizeof(value));
+    return true;
+}
+
+static bool readVarint(ReplayReader& reader, std::uint64_t& value)
+{
+    value = 0;
+    for (int shift{ 0 }; shift < 64; shift += 7)
+    {
+        if (reader.offset >= reader.file.size())
+            return false;
+        unsigned char byte{ reader.file.data()[reader.offset++] };
+        value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+            return true;
+    }
+    return false;
+}
+
+bool openReplayReader(ReplayReader& reader, const std::string& path)
+{
+    if (!reader.file.open(path) || reader.file.size() < replayHeaderSize
+        || std::memcmp(reader.file.data(), replayMagic, sizeof(replayMagic)) != 0)
+        return false;
+
+    reader.offset = sizeof(replayMagic);
+    reader.tick = 0;
+    reader.corrupt = false;
+
+    std::uint64_t version{}, engine{}, reserved{}, tickRateBits{}, interval{};
+    readUnsigned(reader, 2, version);
+    readUnsigned(reader, 1, engine);
+    readUnsigned(reader, 1, reserved);
+    readUnsigned(reader, 8, reader.header.seed);
+    readUnsigned(reader, 8, tickRateBits);
+    if (version != replayVersion || engine > RNG_XOSHIRO)
+        return false;
+
+    reader.header.engine = static_cast<RngEngine>(engine);
+    std::memcpy(&reader.header.ticksPerSecond, &tickRateBits, sizeof(tickRateBits));
+    readFloat(reader, reader.header.platformScale);
+    readFloat(reader, reader.header.snakeRadius);
+    readFloat(reader, reader.header.snakeMovespeed);
+    readUnsigned(reader, 4, interval);
+    reader.header.foodSpawnInterval = static_cast<std::uint32_t>(interval);
+    return reader.header.ticksPerSecond > 0.0;
+}
+
+bool readReplayRecord(ReplayReader& reader, ReplayRecord& record)
+{
+    if (reader.offset >= reader.file.size())
+        return false;
+
+    std::uint64_t tag{};
+    if (!readVarint(reader, tag) || (tag & 7) > REPLAY_END)
+    {
+        reader.corrupt = true;
+        return false;
+    }
+    reader.tick += tag >> 3;
+    record.tick = reader.tick;
+    record.kind = static_cast<ReplayRecordKind>(tag & 7);
+
+    bool complete{ true };
+    if (record.kind == REPLAY_FOOD)
+        complete = readFloat(reader, record.foodCoords.first) && readFloat(reader, record.foodCoords.second);
+    else if (record.kind == REPLAY_END)
+        complete = readUnsigned(reader, 8, record.hash);
+    if (!complete)
+        reader.corrupt = true;
+    return complete;
+}
+
+bool headerMatchesBoard(const ReplayHeader& header)
+{
+    ReplayHeader current{};
+    return header.platformScale == current.platformScale && header.snakeRadius == current.snakeRadius
+        && header.snakeMovespeed == current.snakeMovespeed && header.foodSpawnInterval == current.foodSpawnInterval;
+}
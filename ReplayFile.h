@@ -0,0 +1,104 @@
+//Compact binary replays, a fixed header followed by varint records that can be streamed straight out of a memory map
+
+#ifndef REPLAY_FILE_H
+#define REPLAY_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#include "SnakeWorld.h"
+
+//Layout, all little endian:
+//  header  "SNKR" | u16 version | u8 engine | u8 reserved | u64 seed | f64 tick rate
+//          | f32 platform scale | f32 snake radius | f32 move speed | u32 food spawn interval
+//  record  varint((tick - previous record's tick) << 3 | kind), then a kind specific payload:
+//          REPLAY_DIRECTION_*  none, the direction is the kind itself
+//          REPLAY_FOOD         f32 x | f32 z of the piece spawned during that tick's step
+//          REPLAY_END          u64 hash of the final state, always the last record
+const std::uint16_t replayVersion{ 1 };
+const std::size_t replayHeaderSize{ 40 };
+
+enum ReplayRecordKind
+{
+    REPLAY_DIRECTION_UP = MOVING_UP,
+    REPLAY_DIRECTION_DOWN = MOVING_DOWN,
+    REPLAY_DIRECTION_LEFT = MOVING_LEFT,
+    REPLAY_DIRECTION_RIGHT = MOVING_RIGHT,
+    REPLAY_FOOD = 4,
+    REPLAY_END = 5
+};
+
+struct ReplayHeader
+{
+    std::uint64_t seed{ 0 };
+    RngEngine engine{ RNG_XOSHIRO };
+    double ticksPerSecond{ 0.0 };
+
+    //Board configuration the replay was recorded with, a replay is only valid against the same constants
+    float platformScale{ ::platformScale };
+    float snakeRadius{ ::snakeRadius };
+    float snakeMovespeed{ ::snakeMovespeed };
+    std::uint32_t foodSpawnInterval{ static_cast<std::uint32_t>(::foodSpawnInterval) };
+};
+
+struct ReplayRecord
+{
+    ReplayRecordKind kind{ REPLAY_END };
+    std::uint64_t tick{ 0 };
+    std::pair<float, float> foodCoords{};
+    std::uint64_t hash{ 0 };
+};
+
+//Appends records to a file as they are produced, nothing but the current tick is held in memory
+struct ReplayWriter
+{
+    std::ofstream file{};
+    std::uint64_t lastTick{ 0 };
+};
+
+bool openReplayWriter(ReplayWriter& writer, const std::string& path, const ReplayHeader& header);
+void writeReplayRecord(ReplayWriter& writer, const ReplayRecord& record);
+bool closeReplayWriter(ReplayWriter& writer);
+
+//Read-only view of a whole file, pages are only faulted in as the reader walks over them
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const std::string& path);
+    void close();
+    const unsigned char* data() const { return bytes; }
+    std::size_t size() const { return length; }
+
+private:
+    const unsigned char* bytes{ NULL };
+    std::size_t length{ 0 };
+#ifdef _WIN32
+    void* fileHandle{ NULL };
+    void* mappingHandle{ NULL };
+#endif
+};
+
+struct ReplayReader
+{
+    MappedFile file{};
+    ReplayHeader header{};
+    std::size_t offset{ 0 };
+    std::uint64_t tick{ 0 };
+    bool corrupt{ false };
+};
+
+bool openReplayReader(ReplayReader& reader, const std::string& path);
+
+//Decodes the record at the read position, returns false past the end or on a malformed record (sets corrupt)
+bool readReplayRecord(ReplayReader& reader, ReplayRecord& record);
+
+bool headerMatchesBoard(const ReplayHeader& header);
+
+#endif
@@ -1,7 +1,7 @@
 #version 330 core
 out vec4 FragColor;
 
-uniform vec3 boxColor;
+in vec3 boxColor;
 
 void main()
 {
@@ -1,11 +1,19 @@
 #version 330 core
 layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aOffset;
+layout (location = 2) in vec3 aScale;
+layout (location = 3) in vec3 aColor;
 
-uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
+out vec3 boxColor;
+
+layout (std140) uniform CameraBlock
+{
+    mat4 view;
+    mat4 projection;
+};
 
 void main()
 {
-    gl_Position = projection * view * model * vec4(aPos, 1.0); 
+    gl_Position = projection * view * vec4(aPos * aScale + aOffset, 1.0); 
+    boxColor = aColor;
 }
\ No newline at end of file
@@ -0,0 +1,125 @@
+//Growable ring buffer with O(1) push/pop at both ends, storage stays one contiguous power of two sized block
+
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <vector>
+#include <cstddef>
+#include <iterator>
+
+template <typename T>
+class RingBuffer
+{
+public:
+    template <typename Buffer, typename Value>
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Value*;
+        using reference = Value&;
+
+        Iterator(Buffer* ring, std::size_t index) : ring{ ring }, index{ index } {}
+
+        reference operator*() const { return (*ring)[index]; }
+        pointer operator->() const { return &(*ring)[index]; }
+        Iterator& operator++() { ++index; return *this; }
+        Iterator operator++(int) { Iterator previous{ *this }; ++index; return previous; }
+        bool operator==(const Iterator& other) const { return index == other.index; }
+        bool operator!=(const Iterator& other) const { return index != other.index; }
+
+    private:
+        Buffer* ring{};
+        std::size_t index{};
+    };
+
+    using iterator = Iterator<RingBuffer, T>;
+    using const_iterator = Iterator<const RingBuffer, const T>;
+
+    RingBuffer() = default;
+
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    std::size_t capacity() const { return buffer.size(); }
+
+    //Storage slot holding element i, stable until the next reallocation
+    std::size_t slotOf(std::size_t i) const { return (head + i) & mask; }
+
+    T& operator[](std::size_t i) { return buffer[(head + i) & mask]; }
+    const T& operator[](std::size_t i) const { return buffer[(head + i) & mask]; }
+    T& front() { return buffer[head]; }
+    const T& front() const { return buffer[head]; }
+    T& back() { return (*this)[count - 1]; }
+    const T& back() const { return (*this)[count - 1]; }
+
+    void push_front(const T& value)
+    {
+        if (count == buffer.size())
+            grow(count + 1);
+        head = (head - 1) & mask;
+        buffer[head] = value;
+        ++count;
+    }
+
+    void push_back(const T& value)
+    {
+        if (count == buffer.size())
+            grow(count + 1);
+        buffer[(head + count) & mask] = value;
+        ++count;
+    }
+
+    void pop_front()
+    {
+        head = (head + 1) & mask;
+        --count;
+    }
+
+    void pop_back()
+    {
+        --count;
+    }
+
+    void clear()
+    {
+        head = 0;
+        count = 0;
+    }
+
+    void reserve(std::size_t minCapacity)
+    {
+        if (minCapacity > buffer.size())
+            grow(minCapacity);
+    }
+
+    iterator begin() { return iterator{ this, 0 }; }
+    iterator end() { return iterator{ this, count }; }
+    const_iterator begin() const { return const_iterator{ this, 0 }; }
+    const_iterator end() const { return const_iterator{ this, count }; }
+
+private:
+    //Reallocates to the next power of two and unwraps the contents so the front lands in slot 0
+    void grow(std::size_t minCapacity)
+    {
+        std::size_t newCapacity{ buffer.empty() ? 8 : buffer.size() };
+        while (newCapacity < minCapacity)
+            newCapacity *= 2;
+
+        std::vector<T> newBuffer(newCapacity);
+        for (std::size_t i{ 0 }; i < count; i++)
+            newBuffer[i] = (*this)[i];
+
+        buffer.swap(newBuffer);
+        head = 0;
+        mask = newCapacity - 1;
+    }
+
+    std::vector<T> buffer{};
+    std::size_t head{ 0 };
+    std::size_t count{ 0 };
+    std::size_t mask{ 0 };
+};
+
+#endif
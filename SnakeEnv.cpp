@@ -0,0 +1,140 @@
+#include "SnakeEnv.h"
+
+#include <cstring>
+#include <stdexcept>
+
+const EnvConfig& checkEnvConfig(const EnvConfig& config)
+{
+    if (!isValidGridBoard(config.columns, config.rows))
+        throw std::invalid_argument("board needs at least 2 columns and 3 rows, and no more cells than fit an int");
+    return config;
+}
+
+//The config is checked before world is built, GridWorld::reset would otherwise write off the end of the board
+SnakeEnv::SnakeEnv(const EnvConfig& config)
+    : config{ checkEnvConfig(config) }, world{ 0, RNG_XOSHIRO, config.columns, config.rows }
+{
+    //Every allocation an episode could need happens here, the body is the only thing that grows
+    world.snake.body.reserve(world.bodyCells.size());
+    world.foodContainer.reserve(world.bodyCells.size());
+}
+
+void SnakeEnv::bindObservation(const EnvObservation& observation)
+{
+    this->observation = observation;
+}
+
+void SnakeEnv::reset(std::uint64_t seed)
+{
+    world.reset(seed);
+    episodeSteps = 0;
+    episodeOver = false;
+    spawnFood();
+    writeBoard();
+    writeHead();
+    writeFood();
+}
+
+EnvStep SnakeEnv::step(int action)
+{
+    EnvStep result{};
+    if (episodeOver)
+    {
+        result.status = ENV_TERMINATED;
+        return result;
+    }
+
+    if (action >= MOVING_UP && action <= MOVING_RIGHT)
+        world.snake.currentDirection = static_cast<SnakeDirection>(action);
+    std::uint32_t oldHead{ world.snake.body.front() };
+    std::uint32_t oldTail{ world.snake.body.back() };
+    std::size_t oldSize{ world.snake.body.size() };
+    std::size_t oldFood{ world.foodContainer.size() };
+    ++episodeSteps;
+    result.reward = config.stepReward;
+
+    if (!advanceGridSnake(world))
+    {
+        result.reward = config.deathReward;
+        result.status = ENV_TERMINATED;
+        episodeOver = true;
+        return result;
+    }
+
+    //The tail has to be cleared before the head is drawn, the head may have moved onto it
+    std::uint32_t newHead{ world.snake.body.front() };
+    if (observation.board != NULL)
+    {
+        if (world.snake.body.size() == oldSize)
+            observation.board[oldTail] = envCellEmpty;
+        observation.board[oldHead] = envCellBody;
+        observation.board[newHead] = envCellHead;
+    }
+    writeHead();
+
+    if (world.foodContainer.size() < oldFood)
+    {
+        result.reward += config.foodReward;
+        spawnFood();
+        writeFood();
+    }
+
+    if (world.snake.body.size() == world.bodyCells.size())
+    {
+        result.status = ENV_TERMINATED;
+        episodeOver = true;
+    }
+    else if (config.maxSteps != 0 && episodeSteps >= config.maxSteps)
+    {
+        result.status = ENV_TRUNCATED;
+        episodeOver = true;
+    }
+    return result;
+}
+
+//Tops the board back up to foodCount pieces, marking each new one on the board observation
+void SnakeEnv::spawnFood()
+{
+    while (world.foodContainer.size() < config.foodCount && addGridFood(world))
+    {
+        if (observation.board != NULL)
+            observation.board[world.foodContainer.back()] = envCellFood;
+    }
+}
+
+void SnakeEnv::writeBoard()
+{
+    if (observation.board == NULL)
+        return;
+
+    std::memset(observation.board, envCellEmpty, world.bodyCells.size());
+    for (std::uint32_t cell : world.snake.body)
+        observation.board[cell] = envCellBody;
+    observation.board[world.snake.body.front()] = envCellHead;
+    for (std::uint32_t cell : world.foodContainer)
+        observation.board[cell] = envCellFood;
+}
+
+void SnakeEnv::writeHead()
+{
+    if (observation.head == NULL)
+        return;
+
+    std::uint32_t headCell{ world.snake.body.front() };
+    observation.head[0] = static_cast<std::int32_t>(headCell / static_cast<std::uint32_t>(world.columns));
+    observation.head[1] = static_cast<std::int32_t>(headCell % static_cast<std::uint32_t>(world.columns));
+}
+
+void SnakeEnv::writeFood()
+{
+    if (observation.food == NULL)
+        return;
+
+    for (std::uint32_t slot{ 0 }; slot < observation.foodSlots; slot++)
+    {
+        bool used{ slot < world.foodContainer.size() };
+        std::uint32_t cell{ used ? world.foodContainer[slot] : 0 };
+        observation.food[2 * slot] = used ? static_cast<std::int32_t>(cell / static_cast<std::uint32_t>(world.columns)) : -1;
+        observation.food[2 * slot + 1] = used ? static_cast<std::int32_t>(cell % static_cast<std::uint32_t>(world.columns)) : -1;
+    }
+}
@@ -0,0 +1,87 @@
+//Reinforcement learning interface over grid mode: reset(seed) and step(action) -> (reward, done), with the
+//observation written straight into buffers the trainer owns. Nothing is allocated after construction, and a
+//step only rewrites the handful of board cells that changed
+
+#ifndef SNAKE_ENV_H
+#define SNAKE_ENV_H
+
+#include <cstdint>
+
+#include "GridWorld.h"
+
+//Values written to the board observation
+const std::uint8_t envCellEmpty{ 0 };
+const std::uint8_t envCellBody{ 1 };
+const std::uint8_t envCellHead{ 2 };
+const std::uint8_t envCellFood{ 3 };
+
+struct EnvConfig
+{
+    int columns{ gridBoardCells };
+    int rows{ gridBoardCells };
+    std::uint32_t foodCount{ 1 }; //Food kept on the board, a piece that is eaten is replaced straight away
+    std::uint64_t maxSteps{ 0 }; //Episodes are cut off after this many steps, 0 for never
+    float foodReward{ 1.0f };
+    float deathReward{ -1.0f };
+    float stepReward{ 0.0f };
+};
+
+//Caller owned buffers the observation is written into, any of them may be NULL to leave that part out
+struct EnvObservation
+{
+    std::uint8_t* board{ NULL }; //rows * columns envCell values, row major in the same cell order as GridWorld
+    std::int32_t* head{ NULL }; //Row then column of the head
+    std::int32_t* food{ NULL }; //Row then column of each food piece, foodSlots pairs, unused pairs are -1
+    std::uint32_t foodSlots{ 0 };
+};
+
+enum EnvStatus
+{
+    ENV_RUNNING,
+    ENV_TERMINATED, //Died, or filled the board
+    ENV_TRUNCATED //Hit maxSteps
+};
+
+struct EnvStep
+{
+    float reward{ 0.0f };
+    EnvStatus status{ ENV_RUNNING };
+};
+
+//Returns config, or throws std::invalid_argument if its board fails isValidGridBoard
+const EnvConfig& checkEnvConfig(const EnvConfig& config);
+
+class SnakeEnv
+{
+public:
+    //Throws std::invalid_argument for a board that fails isValidGridBoard
+    explicit SnakeEnv(const EnvConfig& config = EnvConfig{});
+
+    //The buffers are kept until the next bind, step() relies on them still holding what it last wrote
+    void bindObservation(const EnvObservation& observation);
+
+    //Starts a new episode and writes the whole observation
+    void reset(std::uint64_t seed);
+
+    //action is a SnakeDirection, anything else keeps the current heading, as does reversing onto the body.
+    //Stepping after the episode has ended does nothing until the next reset
+    EnvStep step(int action);
+
+    const GridWorld& getWorld() const { return world; }
+    const EnvConfig& getConfig() const { return config; }
+    std::uint64_t getEpisodeSteps() const { return episodeSteps; }
+
+private:
+    void spawnFood();
+    void writeBoard();
+    void writeHead();
+    void writeFood();
+
+    EnvConfig config{};
+    GridWorld world;
+    EnvObservation observation{};
+    std::uint64_t episodeSteps{ 0 };
+    bool episodeOver{ false };
+};
+
+#endif
@@ -0,0 +1,160 @@
+#include "SnakeMesh.h"
+
+#include <cmath>
+#include <vector>
+
+const std::size_t cornersPerSegment{ 8 };
+const std::size_t indicesPerSegment{ 36 };
+
+//Same corner numbering and winding as buildCubeMesh, offset per slot
+const unsigned int segmentCornerIndices[indicesPerSegment]{
+    2, 3, 1, 2, 1, 0,
+    4, 5, 7, 4, 7, 6,
+    4, 6, 2, 4, 2, 0,
+    1, 3, 7, 1, 7, 5,
+    0, 1, 5, 0, 5, 4,
+    6, 7, 3, 6, 3, 2
+};
+
+//Binds through renderState, raw binds here would leave its shadow out of step with the context
+void initSnakeMesh(SnakeMesh& mesh, RenderState& renderState)
+{
+    glGenVertexArrays(1, &mesh.VAO);
+    glGenBuffers(1, &mesh.VBO);
+    glGenBuffers(1, &mesh.EBO);
+
+    //The element buffer binding is part of the VAO, so it stays bound and unbinding the VAO is enough
+    bindVertexArray(renderState, mesh.VAO);
+    bindBuffer(renderState, GL_ARRAY_BUFFER, mesh.VBO);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.EBO);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    bindVertexArray(renderState, 0);
+
+    mesh.capacity = 0;
+    mesh.uploaded = false;
+}
+
+void deleteSnakeMesh(SnakeMesh& mesh)
+{
+    glDeleteVertexArrays(1, &mesh.VAO);
+    glDeleteBuffers(1, &mesh.VBO);
+    glDeleteBuffers(1, &mesh.EBO);
+    mesh = SnakeMesh{};
+}
+
+void getSegmentBox(const SnakeSegment& segment, glm::vec3& position, glm::vec3& scale)
+{
+    if (segment.direction == MOVING_UP || segment.direction == MOVING_DOWN)
+    {
+        float xScale{ std::abs(segment.frontCoord.first - segment.backCoord.first) };
+        position = glm::vec3((segment.frontCoord.first + segment.backCoord.first) / 2, 0.5f, segment.frontCoord.second);
+        scale = glm::vec3(xScale, 0.25f, 0.25f);
+    }
+    else
+    {
+        float zScale{ std::abs(segment.frontCoord.second - segment.backCoord.second) };
+        position = glm::vec3(segment.frontCoord.first, 0.5f, (segment.frontCoord.second + segment.backCoord.second) / 2);
+        scale = glm::vec3(0.25f, 0.25f, zScale);
+    }
+}
+
+//The segment as drawn this frame, with the head and tail moved on by renderAhead
+static void getRenderedCorners(Snake& snake, std::size_t index, float renderAhead, glm::vec3 corners[cornersPerSegment])
+{
+    std::size_t numSegments{ snake.snakeBody.size() };
+    SnakeSegment segment{ snake.snakeBody[index] };
+    if (index == 0)
+        moveCoord(segment.frontCoord, segment.direction, renderAhead);
+    //The tail only follows once the snake has reached its full length
+    bool inX{ segment.direction == MOVING_UP || segment.direction == MOVING_DOWN };
+    if (index == numSegments - 1 && !(snake.bodyLength < snake.length) && getSegmentLength(segment, inX) > renderAhead)
+        moveCoord(segment.backCoord, segment.direction, renderAhead);
+
+    glm::vec3 position{};
+    glm::vec3 scale{};
+    getSegmentBox(segment, position, scale);
+    for (std::size_t corner{ 0 }; corner < cornersPerSegment; corner++)
+    {
+        glm::vec3 unitCorner{ (corner & 1) ? 0.5f : -0.5f, (corner & 2) ? 0.5f : -0.5f, (corner & 4) ? 0.5f : -0.5f };
+        corners[corner] = position + unitCorner * scale;
+    }
+}
+
+//Writes body indices [first, first + count), split where their slots wrap round the end of the ring
+static void writeSegments(SnakeMesh& mesh, Snake& snake, std::size_t first, std::size_t count, float renderAhead)
+{
+    std::vector<glm::vec3> corners(count * cornersPerSegment);
+    for (std::size_t i{ 0 }; i < count; i++)
+        getRenderedCorners(snake, first + i, renderAhead, &corners[i * cornersPerSegment]);
+
+    std::size_t firstSlot{ snake.snakeBody.slotOf(first) };
+    std::size_t firstRun{ mesh.capacity - firstSlot < count ? mesh.capacity - firstSlot : count };
+    const std::size_t slotBytes{ cornersPerSegment * sizeof(glm::vec3) };
+    glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(firstSlot * slotBytes), static_cast<GLsizeiptr>(firstRun * slotBytes), corners.data());
+    if (firstRun < count)
+        glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>((count - firstRun) * slotBytes), &corners[firstRun * cornersPerSegment]);
+    mesh.segmentWrites += count;
+}
+
+//Sizes both buffers for the ring's capacity and fills the index buffer, which never changes until the ring grows again
+static void resizeSnakeMesh(SnakeMesh& mesh, RenderState& renderState, std::size_t capacity)
+{
+    std::vector<unsigned int> indices(capacity * indicesPerSegment);
+    for (std::size_t slot{ 0 }; slot < capacity; slot++)
+    {
+        for (std::size_t i{ 0 }; i < indicesPerSegment; i++)
+            indices[slot * indicesPerSegment + i] = static_cast<unsigned int>(slot * cornersPerSegment) + segmentCornerIndices[i];
+    }
+
+    bindVertexArray(renderState, mesh.VAO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indices.size() * sizeof(unsigned int)), indices.data(), GL_STATIC_DRAW);
+    bindBuffer(renderState, GL_ARRAY_BUFFER, mesh.VBO);
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(capacity * cornersPerSegment * sizeof(glm::vec3)), NULL, GL_DYNAMIC_DRAW);
+    mesh.capacity = capacity;
+}
+
+//Segments from index 2 back never change (SnakeWorld.h), so besides the head and tail only the segments pushed
+//since the last upload and the old head that addSegment pulled back need rewriting
+void updateSnakeMesh(SnakeMesh& mesh, RenderState& renderState, Snake& snake, float renderAhead)
+{
+    std::size_t numSegments{ snake.snakeBody.size() };
+    std::uint32_t newSegments{ snake.headSerial - mesh.uploadedHeadSerial };
+    bool rebuild{ !mesh.uploaded || mesh.capacity != snake.snakeBody.capacity() || newSegments >= numSegments };
+
+    if (mesh.capacity != snake.snakeBody.capacity())
+        resizeSnakeMesh(mesh, renderState, snake.snakeBody.capacity());
+    bindBuffer(renderState, GL_ARRAY_BUFFER, mesh.VBO);
+
+    if (rebuild)
+    {
+        writeSegments(mesh, snake, 0, numSegments, renderAhead);
+    }
+    else
+    {
+        writeSegments(mesh, snake, 0, newSegments + 1, renderAhead);
+        if (numSegments - 1 > newSegments)
+            writeSegments(mesh, snake, numSegments - 1, 1, renderAhead);
+    }
+    mesh.uploadedHeadSerial = snake.headSerial;
+    mesh.uploaded = true;
+}
+
+//The live slots run from the head's slot to the end of the ring and on from slot 0 if they wrap
+void drawSnakeMesh(SnakeMesh& mesh, RenderState& renderState, Snake& snake, const glm::vec3& color)
+{
+    std::size_t count{ snake.snakeBody.size() };
+    std::size_t firstSlot{ snake.snakeBody.slotOf(0) };
+    std::size_t firstRun{ mesh.capacity - firstSlot < count ? mesh.capacity - firstSlot : count };
+
+    //The corners are already in world space, so the instance attributes the box shader expects are held constant
+    glVertexAttrib3f(1, 0.0f, 0.0f, 0.0f);
+    glVertexAttrib3f(2, 1.0f, 1.0f, 1.0f);
+    glVertexAttrib3f(3, color.x, color.y, color.z);
+
+    bindVertexArray(renderState, mesh.VAO);
+    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(firstRun * indicesPerSegment), GL_UNSIGNED_INT,
+        (void*)(firstSlot * indicesPerSegment * sizeof(unsigned int)));
+    if (firstRun < count)
+        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>((count - firstRun) * indicesPerSegment), GL_UNSIGNED_INT, (void*)0);
+}
@@ -0,0 +1,40 @@
+//The whole snake body as one GPU mesh, a box of 8 corners per ring buffer slot, so a frame only rewrites the
+//slots that changed instead of re-streaming every segment
+
+#ifndef SNAKE_MESH_H
+#define SNAKE_MESH_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "SnakeWorld.h"
+#include "RenderState.h"
+
+//Vertex data for snakeBody slot s lives at corners [8s, 8s + 8) and its 36 indices at [36s, 36s + 36), so the live
+//part of the ring is at most two contiguous index ranges
+struct SnakeMesh
+{
+    unsigned int VAO{ 0 };
+    unsigned int VBO{ 0 };
+    unsigned int EBO{ 0 };
+    std::size_t capacity{ 0 }; //Ring capacity the buffers were sized for, a ring reallocation moves every slot
+    std::uint32_t uploadedHeadSerial{ 0 };
+    bool uploaded{ false };
+    unsigned long long segmentWrites{ 0 }; //Segments written to the GPU, to confirm uploads stay O(1) per frame
+};
+
+void initSnakeMesh(SnakeMesh& mesh, RenderState& renderState);
+void deleteSnakeMesh(SnakeMesh& mesh);
+
+//Brings the mesh up to date with the snake. renderAhead is how far the snake has moved since the last tick,
+//the head and tail are drawn that much further along so motion stays smooth between ticks
+void updateSnakeMesh(SnakeMesh& mesh, RenderState& renderState, Snake& snake, float renderAhead);
+void drawSnakeMesh(SnakeMesh& mesh, RenderState& renderState, Snake& snake, const glm::vec3& color);
+
+//Centre and size of the box drawn for a segment
+void getSegmentBox(const SnakeSegment& segment, glm::vec3& position, glm::vec3& scale);
+
+#endif
@@ -0,0 +1,573 @@
+#include "SnakeWorld.h"
+#include "Profiler.h"
+
+#include <cmath>
+#include <chrono>
+#include <cassert>
+
+SnakeWorld::SnakeWorld()
+    : SnakeWorld(static_cast<std::uint64_t>(std::chrono::system_clock::now().time_since_epoch().count()))
+{
+}
+
+SnakeWorld::SnakeWorld(std::uint64_t seed, RngEngine engine)
+{
+    randomGen.seed(seed, engine);
+    reset(seed);
+}
+
+void SnakeWorld::reset(std::uint64_t seed)
+{
+    snake = Snake{};
+    pushHeadSegment(snake, SnakeSegment{ {0.0f, 0.0f}, {0.5f, 0.0f}, MOVING_UP });
+    snake.currentDirection = MOVING_UP;
+    snake.bodyLength = getSnakeLength(snake);
+
+    foodContainer.clear();
+    foodGrid.clear();
+    randomGen.seed(seed, randomGen.getEngine());
+    this->seed = seed;
+    stepCount = 0;
+    gameOver = false;
+    spawnedFood = false;
+}
+
+void SnakeWorld::step(float dt)
+{
+    {
+        PROFILE_SCOPE(PROFILE_FOOD);
+        spawnedFood = (stepCount % foodSpawnInterval == 0) && addFood(snake, foodContainer, foodGrid, randomGen);
+        if (spawnedFood)
+            spawnedFoodCoords = foodContainer.back();
+    }
+    ++stepCount;
+
+    {
+        PROFILE_SCOPE(PROFILE_MOVE);
+        moveSnake(snake, dt);
+    }
+    PROFILE_SCOPE(PROFILE_COLLISIONS);
+    if (handleCollisions(snake, foodContainer, foodGrid))
+        gameOver = true;
+}
+
+void moveSnake(Snake& snake, float dt)
+{
+    float snakeLength{ snake.bodyLength };
+    if (snake.currentDirection != snake.snakeBody[0].direction)
+    {
+        addSegment(snake);
+        handleMovement(snake, !(snakeLength < snake.length), dt);
+    }
+    else
+    {
+        handleMovement(snake, !(snakeLength < snake.length), dt);
+    }
+
+#ifndef NDEBUG
+    validateSnakeLength(snake);
+#endif
+}
+
+void handleMovement(Snake& snake, bool moveBack, float dt)
+{
+    moveCoord(snake.snakeBody[0].frontCoord, snake.snakeBody[0].direction, snakeMovespeed * dt);
+    updateSegmentBounds(snake, 0);
+    snake.bodyLength += snakeMovespeed * dt;
+
+    if (moveBack)
+    {       
+        std::size_t numSegments{ snake.snakeBody.size() - 1 };
+        float distanceIncrement = snakeMovespeed * dt;
+        //Popping a segment of length L and pulling the new tail in by the rest still shortens the body by exactly the increment
+        snake.bodyLength -= distanceIncrement;
+        //Check if snake movement deletes a segment
+        if (snake.snakeBody[numSegments].direction == MOVING_UP || snake.snakeBody[numSegments].direction == MOVING_DOWN)
+        {
+            float currentSegmentLength{ getSegmentLength(snake.snakeBody[numSegments], true) };
+            if (distanceIncrement >= currentSegmentLength)
+            {
+                popTailSegment(snake);
+                distanceIncrement -= currentSegmentLength;
+            }
+        }
+        else
+        {
+            float currentSegmentLength{ getSegmentLength(snake.snakeBody[numSegments], false) };
+            if (distanceIncrement >= currentSegmentLength)
+            {
+                popTailSegment(snake);
+                distanceIncrement -= currentSegmentLength;
+            }
+        }
+
+        numSegments = snake.snakeBody.size() - 1;
+        moveCoord(snake.snakeBody[numSegments].backCoord, snake.snakeBody[numSegments].direction, distanceIncrement);
+        updateSegmentBounds(snake, numSegments);
+    }        
+}
+
+//Moves a coordinate distance units along direction
+void moveCoord(std::pair<float, float>& coord, SnakeDirection direction, float distance)
+{
+    switch (direction)
+    {
+        case MOVING_UP:
+            coord.first -= distance;
+            break;
+        case MOVING_DOWN:
+            coord.first += distance;
+            break;
+        case MOVING_LEFT:
+            coord.second += distance;
+            break;
+        case MOVING_RIGHT:
+            coord.second -= distance;
+            break;
+    }
+}
+
+float getSnakeLength(Snake& snake)
+{
+    float totalLength{ 0 };
+    for (auto& segment : snake.snakeBody)
+    {
+        if (segment.direction == MOVING_UP || segment.direction == MOVING_DOWN)
+            totalLength += getSegmentLength(segment, true);
+        else if (segment.direction == MOVING_LEFT || segment.direction == MOVING_RIGHT)
+            totalLength += getSegmentLength(segment, false);
+    }
+    return totalLength;
+}
+
+//Cross checks the incrementally maintained bodyLength against a full walk of the body
+void validateSnakeLength(Snake& snake)
+{
+    float walkedLength{ getSnakeLength(snake) };
+    float tolerance{ 1e-3f * (walkedLength > 1.0f ? walkedLength : 1.0f) };
+    assert(std::abs(walkedLength - snake.bodyLength) <= tolerance && "Snake::bodyLength drifted from the segment walk");
+    (void)walkedLength;
+    (void)tolerance;
+}
+
+float getSegmentLength(SnakeSegment& snakeSegment, bool inX)
+{
+    if(inX)
+        return std::abs(snakeSegment.frontCoord.first - snakeSegment.backCoord.first);
+    return std::abs(snakeSegment.frontCoord.second - snakeSegment.backCoord.second);
+}
+
+void addSegment(Snake& snake)
+{
+    std::pair<float, float> headCoord{ snake.snakeBody[0].frontCoord };  
+    switch (snake.snakeBody[0].direction)
+    { 
+        case MOVING_UP:
+            switch (snake.currentDirection)
+            {
+                case MOVING_LEFT:
+                    snake.snakeBody[0].frontCoord.first += 2*snakeRadius;
+                    pushHeadSegment(snake, SnakeSegment{ {headCoord.first + snakeRadius, headCoord.second + snakeRadius},{headCoord.first + snakeRadius, headCoord.second - snakeRadius},MOVING_LEFT });
+                    break;
+                case MOVING_RIGHT:
+                    snake.snakeBody[0].frontCoord.first += 2 * snakeRadius;
+                    pushHeadSegment(snake, SnakeSegment{ {headCoord.first + snakeRadius, headCoord.second - snakeRadius},{headCoord.first + snakeRadius, headCoord.second + snakeRadius},MOVING_RIGHT });
+                    break;
+                case MOVING_DOWN:
+                    snake.currentDirection = snake.snakeBody[0].direction;
+                    break;
+            }
+            break;
+        case MOVING_DOWN:
+            switch (snake.currentDirection)
+            {
+                case MOVING_LEFT:
+                    snake.snakeBody[0].frontCoord.first -= 2 * snakeRadius;
+                    pushHeadSegment(snake, SnakeSegment{ {headCoord.first - snakeRadius, headCoord.second + snakeRadius},{headCoord.first - snakeRadius, headCoord.second - snakeRadius},MOVING_LEFT });
+                    break;
+                case MOVING_RIGHT:
+                    snake.snakeBody[0].frontCoord.first -= 2 * snakeRadius;
+                    pushHeadSegment(snake, SnakeSegment{ {headCoord.first - snakeRadius, headCoord.second - snakeRadius},{headCoord.first - snakeRadius, headCoord.second + snakeRadius},MOVING_RIGHT });
+                    break;
+                case MOVING_UP:
+                    snake.currentDirection = snake.snakeBody[0].direction;
+                    break;
+            }
+            break;
+        case MOVING_LEFT:
+            switch (snake.currentDirection)
+            {
+                case MOVING_UP:
+                    snake.snakeBody[0].frontCoord.second -= 2 * snakeRadius;
+                    pushHeadSegment(snake, SnakeSegment{ {headCoord.first - snakeRadius, headCoord.second - snakeRadius},{headCoord.first + snakeRadius, headCoord.second - snakeRadius},MOVING_UP });
+                    break;
+                case MOVING_DOWN:
+                    snake.snakeBody[0].frontCoord.second -= 2 * snakeRadius;
+                    pushHeadSegment(snake, SnakeSegment{ {headCoord.first + snakeRadius, headCoord.second - snakeRadius},{headCoord.first - snakeRadius, headCoord.second - snakeRadius},MOVING_DOWN });
+                    break;
+                case MOVING_RIGHT:
+                    snake.currentDirection = snake.snakeBody[0].direction;
+                    break;
+            }
+            break;
+        case MOVING_RIGHT:
+            switch (snake.currentDirection)
+            {
+                case MOVING_UP:
+                    snake.snakeBody[0].frontCoord.second += 2 * snakeRadius;
+                    pushHeadSegment(snake, SnakeSegment{ {headCoord.first - snakeRadius, headCoord.second + snakeRadius},{headCoord.first + snakeRadius, headCoord.second + snakeRadius},MOVING_UP });
+                    break;
+                case MOVING_DOWN:
+                    snake.snakeBody[0].frontCoord.second += 2 * snakeRadius;
+                    pushHeadSegment(snake, SnakeSegment{ {headCoord.first + snakeRadius, headCoord.second + snakeRadius},{headCoord.first - snakeRadius, headCoord.second + snakeRadius},MOVING_DOWN });
+                    break;
+                case MOVING_LEFT:
+                    snake.currentDirection = snake.snakeBody[0].direction;
+                    break;
+            }
+            break;
+    }
+}
+
+//Pushes a new head, and registers the segment that this moves to index 2 in the broad-phase grid
+void pushHeadSegment(Snake& snake, const SnakeSegment& segment)
+{
+    std::size_t oldCapacity{ snake.snakeBody.capacity() };
+    snake.snakeBody.push_front(segment);
+    ++snake.headSerial;
+
+    //Growing the ring moves every segment to a new slot, otherwise only the new head and the old head (whose front addSegment pulled back) changed
+    if (snake.snakeBody.capacity() != oldCapacity)
+    {
+        rebuildSegmentBounds(snake);
+    }
+    else
+    {
+        updateSegmentBounds(snake, 0);
+        if (snake.snakeBody.size() > 1)
+            updateSegmentBounds(snake, 1);
+    }
+
+    if (snake.snakeBody.size() > 2)
+    {
+        GridEntry entry{};
+        entry.key = snake.headSerial - 2;
+        setBoundsFromSegment(entry.x1, entry.x2, entry.z1, entry.z2, snake.snakeBody[2]);
+        snake.bodyGrid.insert(entry);
+        snake.bodyGridEntries.push_front(entry);
+    }
+}
+
+//Segments are registered and popped in serial order, so a registered tail is always the oldest entry
+void popTailSegment(Snake& snake)
+{
+    std::uint32_t tailSerial{ snake.headSerial - static_cast<std::uint32_t>(snake.snakeBody.size() - 1) };
+    if (!snake.bodyGridEntries.empty() && snake.bodyGridEntries.back().key == tailSerial)
+    {
+        snake.bodyGrid.remove(snake.bodyGridEntries.back());
+        snake.bodyGridEntries.pop_back();
+    }
+    snake.snakeBody.pop_back();
+}
+
+void updateSegmentBounds(Snake& snake, std::size_t index)
+{
+    std::size_t slot{ snake.snakeBody.slotOf(index) };
+    SegmentBounds& bounds{ snake.bodyBounds };
+    setBoundsFromSegment(bounds.x1[slot], bounds.x2[slot], bounds.z1[slot], bounds.z2[slot], snake.snakeBody[index]);
+}
+
+void rebuildSegmentBounds(Snake& snake)
+{
+    std::size_t capacity{ snake.snakeBody.capacity() };
+    snake.bodyBounds.x1.assign(capacity, 0.0f);
+    snake.bodyBounds.x2.assign(capacity, 0.0f);
+    snake.bodyBounds.z1.assign(capacity, 0.0f);
+    snake.bodyBounds.z2.assign(capacity, 0.0f);
+    for (std::size_t i{ 0 }; i < snake.snakeBody.size(); i++)
+        updateSegmentBounds(snake, i);
+}
+
+//Rebuilds the grid registrations and the bounds arrays, for bodies that were built without pushHeadSegment
+void rebuildBodyIndex(Snake& snake)
+{
+    rebuildSegmentBounds(snake);
+    snake.bodyGrid.clear();
+    snake.bodyGridEntries.clear();
+    for (std::size_t i{ snake.snakeBody.size() }; i-- > 2;)
+    {
+        GridEntry entry{};
+        entry.key = snake.headSerial - static_cast<std::uint32_t>(i);
+        setBoundsFromSegment(entry.x1, entry.x2, entry.z1, entry.z2, snake.snakeBody[i]);
+        snake.bodyGrid.insert(entry);
+        snake.bodyGridEntries.push_front(entry);
+    }
+}
+
+bool handleCollisions(Snake& snake, std::vector<std::pair<float, float>>& foodContainer, SpatialGrid& foodGrid)
+{
+    bool collided{ false };
+
+    //Platform Collision
+    if (snake.snakeBody[0].frontCoord.first > (platformCenterX + (platformScale * 0.5)) || snake.snakeBody[0].frontCoord.first < (platformCenterX - (platformScale * 0.5)))
+        collided = true;
+    if (snake.snakeBody[0].frontCoord.second > (platformCenterZ + (platformScale * 0.5)) || snake.snakeBody[0].frontCoord.second < (platformCenterZ - (platformScale * 0.5)))
+        collided = true;
+
+    //Self Collision
+    if (checkSelfCollision(snake))
+        collided = true;
+
+    //Food Collision
+    std::size_t foodIndex{ findFoodCollision(snake.snakeBody[0], foodContainer, foodGrid) };
+    if (foodIndex < foodContainer.size())
+    {
+        snake.length += 2 * snakeRadius;
+        removeFoodPiece(foodContainer, foodGrid, foodIndex);
+    }
+    return collided;
+}
+
+//Short bodies are cheapest to scan outright with the SIMD kernel. For long ones only segments sharing a grid
+//cell with one of the head's leading corners can contain that corner
+bool checkSelfCollision(Snake& snake)
+{
+    std::pair<float, float> corners[2]{};
+    getLeadingCorners(snake.snakeBody[0], corners[0], corners[1]);
+
+    std::size_t numSegments{ snake.snakeBody.size() };
+    if (numSegments <= selfCollisionScanLimit)
+    {
+        if (numSegments <= 2)
+            return false;
+
+        //Indices 2 onward sit in at most two contiguous runs of storage slots
+        std::size_t first{ snake.snakeBody.slotOf(2) };
+        std::size_t count{ numSegments - 2 };
+        std::size_t firstRun{ snake.snakeBody.capacity() - first };
+        if (count <= firstRun)
+            return anyBoxContains(snake.bodyBounds, first, count, corners[0], corners[1]);
+        return anyBoxContains(snake.bodyBounds, first, firstRun, corners[0], corners[1])
+            || anyBoxContains(snake.bodyBounds, 0, count - firstRun, corners[0], corners[1]);
+    }
+
+    for (auto& corner : corners)
+    {
+        for (std::uint32_t key : snake.bodyGrid.query(corner.first, corner.second))
+        {
+            std::size_t index{ static_cast<std::uint32_t>(snake.headSerial - key) };
+            if (index >= 2 && index < snake.snakeBody.size() && checkCollision(snake.snakeBody[0], snake.snakeBody[index]))
+                return true;
+        }
+    }
+    return false;
+}
+
+//Returns the index of the first food piece the head overlaps, or foodContainer.size() if there is none
+std::size_t findFoodCollision(SnakeSegment& frontSegment, std::vector<std::pair<float, float>>& foodContainer, SpatialGrid& foodGrid)
+{
+    std::pair<float, float> corners[2]{};
+    getLeadingCorners(frontSegment, corners[0], corners[1]);
+    for (auto& corner : corners)
+    {
+        for (std::uint32_t key : foodGrid.query(corner.first, corner.second))
+        {
+            if (checkFoodCollision(frontSegment, foodContainer[key]))
+                return key;
+        }
+    }
+    return foodContainer.size();
+}
+
+void getLeadingCorners(SnakeSegment& frontSegment, std::pair<float, float>& corner1, std::pair<float, float>& corner2)
+{
+    if (frontSegment.direction == MOVING_DOWN || frontSegment.direction == MOVING_UP)
+    {
+        corner1 = { frontSegment.frontCoord.first, frontSegment.frontCoord.second + snakeRadius };
+        corner2 = { frontSegment.frontCoord.first, frontSegment.frontCoord.second - snakeRadius };
+    }
+    else
+    {
+        corner1 = { frontSegment.frontCoord.first + snakeRadius, frontSegment.frontCoord.second };
+        corner2 = { frontSegment.frontCoord.first - snakeRadius, frontSegment.frontCoord.second };
+    }
+}
+
+bool checkCollision(SnakeSegment& frontSegment, SnakeSegment& segment)
+{
+    float x1{};
+    float x2{};
+    float z1{};
+    float z2{};
+    setBoundsFromSegment(x1, x2, z1, z2, segment);
+
+    //Pair for each leading corner
+    std::pair<float, float> pair1{};
+    std::pair<float, float> pair2{};
+    getLeadingCorners(frontSegment, pair1, pair2);
+    return(inBox(x1, x2, z1, z2, pair1) || inBox(x1, x2, z1, z2, pair2));
+}
+
+bool inBox(float x1, float x2, float z1, float z2, std::pair<float, float>& point)
+{
+    return (((x1 < point.first) && (point.first < x2)) && ((z1 < point.second) && (point.second < z2)));
+}
+
+bool checkFoodCollision(SnakeSegment& frontSegment, std::pair<float,float>& foodCoords)
+{
+    float x1{ foodCoords.first - snakeRadius };
+    float x2{ foodCoords.first + snakeRadius };
+    float z1{ foodCoords.second - snakeRadius };
+    float z2{ foodCoords.second + snakeRadius };
+
+    //Pair for each leading corner
+    std::pair<float, float> pair1{};
+    std::pair<float, float> pair2{};
+    getLeadingCorners(frontSegment, pair1, pair2);
+    return(inBox(x1, x2, z1, z2, pair1) || inBox(x1, x2, z1, z2, pair2));
+}
+
+//Rejection samples the platform a bounded number of times, then falls back to an exact scan of the food
+//lattice (cell centres one snake width apart), so a spot is always found while any lattice cell is free.
+//Returns false only when every cell is covered
+bool addFood(Snake& snake, std::vector<std::pair<float, float>>& foodContainer, SpatialGrid& foodGrid, GameRng& randomGen)
+{
+    //Food centres stay within this distance of the platform centre so the whole piece is on the platform
+    const float placementHalfExtent{ (platformScale / 2) - snakeRadius };
+
+    for (int attempt{ 0 }; attempt < foodPlacementRetries; attempt++)
+    {
+        float sample{ randomGen.nextUnit() };
+        sample = (platformScale * sample - (platformScale / 2)) * ((platformScale - (2 * snakeRadius)) / (platformScale));
+        float xCoord{ sample };
+        sample = randomGen.nextUnit();
+        sample = (platformScale * sample - (platformScale / 2)) * ((platformScale - (2 * snakeRadius)) / (platformScale));
+        float zCoord{ sample };
+
+        std::pair<float, float> foodCoords{ platformCenterX + xCoord, platformCenterZ + zCoord };
+        if (isFoodPlacementFree(snake, foodContainer, foodGrid, foodCoords))
+        {
+            addFoodPiece(foodContainer, foodGrid, foodCoords);
+            return true;
+        }
+    }
+
+    std::vector<std::pair<float, float>> freeCells{};
+    int latticeSize{ static_cast<int>(std::lround((2 * placementHalfExtent) / gridCellSize)) + 1 };
+    for (int column{ 0 }; column < latticeSize; column++)
+    {
+        for (int row{ 0 }; row < latticeSize; row++)
+        {
+            std::pair<float, float> foodCoords{ platformCenterX - placementHalfExtent + (column * gridCellSize), platformCenterZ - placementHalfExtent + (row * gridCellSize) };
+            if (isFoodPlacementFree(snake, foodContainer, foodGrid, foodCoords))
+                freeCells.push_back(foodCoords);
+        }
+    }
+    if (freeCells.empty())
+        return false;
+
+    std::size_t pick{ static_cast<std::size_t>(randomGen.next() % freeCells.size()) };
+    addFoodPiece(foodContainer, foodGrid, freeCells[pick]);
+    return true;
+}
+
+//A food box is one grid cell wide, so it can only touch the cells under its four corners
+bool isFoodPlacementFree(Snake& snake, std::vector<std::pair<float, float>>& foodContainer, SpatialGrid& foodGrid, std::pair<float, float> foodCoords)
+{
+    float x1{ foodCoords.first - snakeRadius };
+    float x2{ foodCoords.first + snakeRadius };
+    float z1{ foodCoords.second - snakeRadius };
+    float z2{ foodCoords.second + snakeRadius };
+    std::pair<float, float> corners[4]{ {x1, z1}, {x1, z2}, {x2, z1}, {x2, z2} };
+
+    //The first two segments are not in the grid, test them directly
+    for (std::size_t i{ 0 }; i < 2 && i < snake.snakeBody.size(); i++)
+    {
+        if (segmentOverlapsBox(snake.snakeBody[i], x1, x2, z1, z2))
+            return false;
+    }
+
+    for (auto& corner : corners)
+    {
+        for (std::uint32_t key : snake.bodyGrid.query(corner.first, corner.second))
+        {
+            std::size_t index{ static_cast<std::uint32_t>(snake.headSerial - key) };
+            if (index >= 2 && index < snake.snakeBody.size() && segmentOverlapsBox(snake.snakeBody[index], x1, x2, z1, z2))
+                return false;
+        }
+        for (std::uint32_t key : foodGrid.query(corner.first, corner.second))
+        {
+            std::pair<float, float>& otherFood{ foodContainer[key] };
+            if (std::abs(otherFood.first - foodCoords.first) < 2 * snakeRadius && std::abs(otherFood.second - foodCoords.second) < 2 * snakeRadius)
+                return false;
+        }
+    }
+    return true;
+}
+
+bool segmentOverlapsBox(SnakeSegment& segment, float x1, float x2, float z1, float z2)
+{
+    float segmentX1{};
+    float segmentX2{};
+    float segmentZ1{};
+    float segmentZ2{};
+    setBoundsFromSegment(segmentX1, segmentX2, segmentZ1, segmentZ2, segment);
+    return (segmentX1 < x2) && (x1 < segmentX2) && (segmentZ1 < z2) && (z1 < segmentZ2);
+}
+
+//Food is registered under the same box checkFoodCollision tests against
+static GridEntry makeFoodEntry(std::size_t index, const std::pair<float, float>& foodCoords)
+{
+    return GridEntry{ static_cast<std::uint32_t>(index), foodCoords.first - snakeRadius, foodCoords.first + snakeRadius, foodCoords.second - snakeRadius, foodCoords.second + snakeRadius };
+}
+
+void addFoodPiece(std::vector<std::pair<float, float>>& foodContainer, SpatialGrid& foodGrid, std::pair<float, float> foodCoords)
+{
+    foodContainer.push_back(foodCoords);
+    foodGrid.insert(makeFoodEntry(foodContainer.size() - 1, foodCoords));
+}
+
+//Swaps the last piece into the hole so only that one piece has to be re-keyed
+void removeFoodPiece(std::vector<std::pair<float, float>>& foodContainer, SpatialGrid& foodGrid, std::size_t index)
+{
+    std::size_t last{ foodContainer.size() - 1 };
+    foodGrid.remove(makeFoodEntry(index, foodContainer[index]));
+    if (index != last)
+    {
+        foodGrid.remove(makeFoodEntry(last, foodContainer[last]));
+        foodContainer[index] = foodContainer[last];
+        foodGrid.insert(makeFoodEntry(index, foodContainer[index]));
+    }
+    foodContainer.pop_back();
+}
+
+void setBoundsFromSegment(float& x1, float& x2, float& z1, float& z2, SnakeSegment& segment)
+{
+    switch (segment.direction)
+    {
+        case MOVING_UP:
+            x1 = segment.frontCoord.first;
+            x2 = segment.backCoord.first;
+            z1 = segment.frontCoord.second - snakeRadius;
+            z2 = segment.frontCoord.second + snakeRadius;
+            break;
+        case MOVING_DOWN:
+            x1 = segment.backCoord.first;
+            x2 = segment.frontCoord.first;
+            z1 = segment.frontCoord.second - snakeRadius;
+            z2 = segment.frontCoord.second + snakeRadius;
+            break;
+        case MOVING_LEFT:
+            x1 = segment.frontCoord.first - snakeRadius;
+            x2 = segment.frontCoord.first + snakeRadius;
+            z1 = segment.backCoord.second;
+            z2 = segment.frontCoord.second;
+            break;
+        case MOVING_RIGHT:
+            x1 = segment.frontCoord.first - snakeRadius;
+            x2 = segment.frontCoord.first + snakeRadius;
+            z1 = segment.frontCoord.second;
+            z2 = segment.backCoord.second;
+            break;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+//Window-free game simulation, +X is down, +Z is LEFT
+
+#ifndef SNAKE_WORLD_H
+#define SNAKE_WORLD_H
+
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+#include "RingBuffer.h"
+#include "SpatialGrid.h"
+#include "GameRng.h"
+#include "CollisionKernel.h"
+
+//Platform variables
+const float platformCenterX{ 0.0f };
+const float platformCenterZ{ 0.0f };
+const float platformScale{ 5.0f };
+
+//Snake variables
+const float snakeMovespeed{ 1.0f };
+const float snakeRadius{ 0.125f };
+
+//Broad-phase grid covering the platform plus a snake radius of overhang, cells are one snake width across
+const float gridCellSize{ 2 * snakeRadius };
+const float gridMinX{ platformCenterX - (platformScale * 0.5f) - snakeRadius };
+const float gridMinZ{ platformCenterZ - (platformScale * 0.5f) - snakeRadius };
+const float gridExtent{ platformScale + (2 * snakeRadius) };
+
+enum SnakeDirection
+{
+    MOVING_UP,
+    MOVING_DOWN,
+    MOVING_LEFT,
+    MOVING_RIGHT
+};
+
+struct SnakeSegment
+{
+    std::pair<float, float> frontCoord{};
+    std::pair<float, float> backCoord{};
+    SnakeDirection direction{};
+};
+
+struct Snake
+{
+    RingBuffer<SnakeSegment> snakeBody{};
+    SnakeDirection currentDirection{};
+    float length{ 1.0f };
+    float bodyLength{ 0.0f }; //Running sum of segment lengths, kept up to date by handleMovement
+
+    //Segments from index 2 back never move again (the tail only shrinks), so they are registered in
+    //bodyGrid under a serial number; snakeBody[i] has serial headSerial - i
+    std::uint32_t headSerial{ 0 };
+    SpatialGrid bodyGrid{ gridMinX, gridMinZ, gridExtent, gridExtent, gridCellSize };
+    RingBuffer<GridEntry> bodyGridEntries{};
+
+    //Bounds of every segment, indexed by its snakeBody storage slot, kept current by handleMovement and pushHeadSegment
+    SegmentBounds bodyBounds{};
+};
+
+//Food is spawned once every foodSpawnInterval steps, steps are fixed ticks of GameClock
+const int foodSpawnInterval{ 125 };
+
+//Bodies up to this many segments are checked by a full SIMD scan of bodyBounds, longer ones go through bodyGrid
+const std::size_t selfCollisionScanLimit{ 64 };
+
+//Random spots addFood tries before falling back to scanning every free cell
+const int foodPlacementRetries{ 8 };
+
+//Owns everything a running game needs, step(dt) advances it without touching GLFW or OpenGL
+struct SnakeWorld
+{
+    Snake snake{};
+    std::vector<std::pair<float, float>> foodContainer{};
+    SpatialGrid foodGrid{ gridMinX, gridMinZ, gridExtent, gridExtent, gridCellSize }; //Keyed by index into foodContainer
+    GameRng randomGen{};
+    std::uint64_t seed{ 0 };
+    std::uint64_t stepCount{ 0 };
+    bool gameOver{ false };
+
+    //Set by the last step() if it placed a piece of food, and where, so replays can log spawns as they happen
+    bool spawnedFood{ false };
+    std::pair<float, float> spawnedFoodCoords{};
+
+    SnakeWorld();
+    explicit SnakeWorld(std::uint64_t seed, RngEngine engine = RNG_XOSHIRO);
+
+    //Restarts the game on a fresh stream from seed, keeping the current engine
+    void reset(std::uint64_t seed);
+    void step(float dt);
+};
+
+void moveSnake(Snake& snake, float dt);
+void handleMovement(Snake& snake, bool moveBack, float dt);
+void moveCoord(std::pair<float, float>& coord, SnakeDirection direction, float distance);
+float getSnakeLength(Snake& snake);
+void validateSnakeLength(Snake& snake);
+void addSegment(Snake& snake);
+void pushHeadSegment(Snake& snake, const SnakeSegment& segment);
+void popTailSegment(Snake& snake);
+void rebuildBodyIndex(Snake& snake);
+void updateSegmentBounds(Snake& snake, std::size_t index);
+void rebuildSegmentBounds(Snake& snake);
+float getSegmentLength(SnakeSegment& snakeSegment, bool inX);
+bool handleCollisions(Snake& snake, std::vector<std::pair<float, float>>& foodContainer, SpatialGrid& foodGrid);
+bool checkSelfCollision(Snake& snake);
+std::size_t findFoodCollision(SnakeSegment& frontSegment, std::vector<std::pair<float, float>>& foodContainer, SpatialGrid& foodGrid);
+void getLeadingCorners(SnakeSegment& frontSegment, std::pair<float, float>& corner1, std::pair<float, float>& corner2);
+bool checkCollision(SnakeSegment& frontSegment, SnakeSegment& segment);
+bool inBox(float x1, float x2, float z1, float z2, std::pair<float, float>& point);
+bool checkFoodCollision(SnakeSegment& segment, std::pair<float, float>& foodCoords);
+bool addFood(Snake& snake, std::vector<std::pair<float, float>>& foodContainer, SpatialGrid& foodGrid, GameRng& randomGen);
+bool isFoodPlacementFree(Snake& snake, std::vector<std::pair<float, float>>& foodContainer, SpatialGrid& foodGrid, std::pair<float, float> foodCoords);
+bool segmentOverlapsBox(SnakeSegment& segment, float x1, float x2, float z1, float z2);
+void addFoodPiece(std::vector<std::pair<float, float>>& foodContainer, SpatialGrid& foodGrid, std::pair<float, float> foodCoords);
+void removeFoodPiece(std::vector<std::pair<float, float>>& foodContainer, SpatialGrid& foodGrid, std::size_t index);
+void setBoundsFromSegment(float& x1, float& x2, float& z1, float& z2, SnakeSegment& segment);
+
+#endif
@@ -0,0 +1,91 @@
+#include "SpatialGrid.h"
+
+#include <cmath>
+
+SpatialGrid::SpatialGrid(float minX, float minZ, float extentX, float extentZ, float cellSize)
+{
+    reset(minX, minZ, extentX, extentZ, cellSize);
+}
+
+void SpatialGrid::reset(float minX, float minZ, float extentX, float extentZ, float cellSize)
+{
+    originX = minX;
+    originZ = minZ;
+    inverseCellSize = 1.0f / cellSize;
+    columns = static_cast<int>(std::ceil(extentX * inverseCellSize));
+    rows = static_cast<int>(std::ceil(extentZ * inverseCellSize));
+    if (columns < 1)
+        columns = 1;
+    if (rows < 1)
+        rows = 1;
+
+    cells.assign(static_cast<std::size_t>(columns) * rows, std::vector<std::uint32_t>{});
+}
+
+void SpatialGrid::clear()
+{
+    for (auto& cell : cells)
+        cell.clear();
+}
+
+void SpatialGrid::insert(const GridEntry& entry)
+{
+    int column1{ toColumn(entry.x1) };
+    int column2{ toColumn(entry.x2) };
+    int row1{ toRow(entry.z1) };
+    int row2{ toRow(entry.z2) };
+    for (int column{ column1 }; column <= column2; column++)
+    {
+        for (int row{ row1 }; row <= row2; row++)
+            cells[static_cast<std::size_t>(column) * rows + row].push_back(entry.key);
+    }
+}
+
+void SpatialGrid::remove(const GridEntry& entry)
+{
+    int column1{ toColumn(entry.x1) };
+    int column2{ toColumn(entry.x2) };
+    int row1{ toRow(entry.z1) };
+    int row2{ toRow(entry.z2) };
+    for (int column{ column1 }; column <= column2; column++)
+    {
+        for (int row{ row1 }; row <= row2; row++)
+        {
+            std::vector<std::uint32_t>& cell{ cells[static_cast<std::size_t>(column) * rows + row] };
+            for (std::size_t i{ 0 }; i < cell.size(); i++)
+            {
+                if (cell[i] == entry.key)
+                {
+                    cell[i] = cell.back();
+                    cell.pop_back();
+                    break;
+                }
+            }
+        }
+    }
+}
+
+const std::vector<std::uint32_t>& SpatialGrid::query(float x, float z) const
+{
+    return cells[static_cast<std::size_t>(toColumn(x)) * rows + toRow(z)];
+}
+
+int SpatialGrid::toColumn(float x) const
+{
+    int column{ static_cast<int>(std::floor((x - originX) * inverseCellSize)) };
+    if (column < 0)
+        return 0;
+    if (column >= columns)
+        return columns - 1;
+    return column;
+}
+
+int SpatialGrid::toRow(float z) const
+{
+    int row{ static_cast<int>(std::floor((z - originZ) * inverseCellSize)) };
+    if (row < 0)
+        return 0;
+    if (row >= rows)
+        return rows - 1;
+    return row;
+}
@@ -0,0 +1,49 @@
+//Uniform broad-phase grid, each cell lists the keys of every box that overlaps it
+
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include <vector>
+#include <cstdint>
+
+//Axis aligned box registered under a key, kept so the exact same cells can be found again on removal
+struct GridEntry
+{
+    std::uint32_t key{};
+    float x1{};
+    float x2{};
+    float z1{};
+    float z2{};
+};
+
+class SpatialGrid
+{
+public:
+    SpatialGrid() = default;
+    SpatialGrid(float minX, float minZ, float extentX, float extentZ, float cellSize);
+
+    void reset(float minX, float minZ, float extentX, float extentZ, float cellSize);
+    void clear();
+
+    void insert(const GridEntry& entry);
+    void remove(const GridEntry& entry);
+
+    //Keys of every box overlapping the cell containing (x, z), points off the grid map to the nearest edge cell
+    const std::vector<std::uint32_t>& query(float x, float z) const;
+
+    int getColumns() const { return columns; }
+    int getRows() const { return rows; }
+
+private:
+    int toColumn(float x) const;
+    int toRow(float z) const;
+
+    std::vector<std::vector<std::uint32_t>> cells{};
+    float originX{ 0.0f };
+    float originZ{ 0.0f };
+    float inverseCellSize{ 1.0f };
+    int columns{ 0 };
+    int rows{ 0 };
+};
+
+#endif
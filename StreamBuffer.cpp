@@ -0,0 +1,118 @@
+#include "StreamBuffer.h"
+
+#include <cstring>
+
+static void createStorage(StreamBuffer& stream, RenderState& renderState)
+{
+    glGenBuffers(1, &stream.buffer);
+    bindBuffer(renderState, GL_ARRAY_BUFFER, stream.buffer);
+    if (stream.mode == STREAM_PERSISTENT)
+    {
+        GLbitfield flags{ GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT };
+        GLsizeiptr totalSize{ static_cast<GLsizeiptr>(stream.regionSize * streamRegions) };
+        glBufferStorage(GL_ARRAY_BUFFER, totalSize, NULL, flags);
+        stream.mapped = static_cast<unsigned char*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, totalSize, flags));
+    }
+    else
+    {
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(stream.regionSize), NULL, GL_STREAM_DRAW);
+    }
+}
+
+//Blocks until the GPU is done with region, counting it as a stall if it was not already finished
+static void waitForRegion(StreamBuffer& stream, int region)
+{
+    GLsync& fence{ stream.fences[region] };
+    if (fence == NULL)
+        return;
+
+    GLenum status{ glClientWaitSync(fence, 0, 0) };
+    if (status == GL_TIMEOUT_EXPIRED)
+    {
+        stream.stalls++;
+        do
+        {
+            status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+        } while (status == GL_TIMEOUT_EXPIRED);
+    }
+    glDeleteSync(fence);
+    fence = NULL;
+}
+
+static void destroyStorage(StreamBuffer& stream, RenderState& renderState)
+{
+    for (int region{ 0 }; region < streamRegions; region++)
+        waitForRegion(stream, region);
+
+    if (stream.mapped != NULL)
+    {
+        bindBuffer(renderState, GL_ARRAY_BUFFER, stream.buffer);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+        stream.mapped = NULL;
+    }
+    glDeleteBuffers(1, &stream.buffer);
+    forgetBuffer(renderState, stream.buffer);
+    stream.buffer = 0;
+}
+
+void initStreamBuffer(StreamBuffer& stream, RenderState& renderState, std::size_t regionSize)
+{
+    stream.mode = GLAD_GL_VERSION_4_4 ? STREAM_PERSISTENT : STREAM_ORPHAN;
+    stream.regionSize = regionSize;
+    stream.region = 0;
+    createStorage(stream, renderState);
+
+    //Mapping can still fail on drivers that report 4.4 but restrict persistent maps, orphaning always works
+    if (stream.mode == STREAM_PERSISTENT && stream.mapped == NULL)
+    {
+        destroyStorage(stream, renderState);
+        stream.mode = STREAM_ORPHAN;
+        createStorage(stream, renderState);
+    }
+}
+
+void deleteStreamBuffer(StreamBuffer& stream, RenderState& renderState)
+{
+    if (stream.buffer != 0)
+        destroyStorage(stream, renderState);
+}
+
+std::size_t writeStreamBuffer(StreamBuffer& stream, RenderState& renderState, const void* data, std::size_t size)
+{
+    //Immutable storage cannot be resized, a frame that outgrows its region gets a new buffer with room to spare
+    if (size > stream.regionSize)
+    {
+        destroyStorage(stream, renderState);
+        stream.regionSize = size > 2 * stream.regionSize ? size : 2 * stream.regionSize;
+        stream.region = 0;
+        createStorage(stream, renderState);
+    }
+
+    bindBuffer(renderState, GL_ARRAY_BUFFER, stream.buffer);
+    if (stream.mode == STREAM_ORPHAN)
+    {
+        //Orphans the previous frame's storage so the driver never has to wait on draws still reading it
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(stream.regionSize), NULL, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(size), data);
+        return 0;
+    }
+
+    waitForRegion(stream, stream.region);
+    std::size_t offset{ static_cast<std::size_t>(stream.region) * stream.regionSize };
+    std::memcpy(stream.mapped + offset, data, size);
+    return offset;
+}
+
+void finishStreamFrame(StreamBuffer& stream)
+{
+    if (stream.mode != STREAM_PERSISTENT)
+        return;
+
+    stream.fences[stream.region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    stream.region = (stream.region + 1) % streamRegions;
+}
+
+const char* getStreamModeName(StreamMode mode)
+{
+    return mode == STREAM_PERSISTENT ? "persistent mapped" : "orphaning";
+}
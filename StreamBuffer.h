@@ -0,0 +1,44 @@
+//Per-frame vertex data streaming without sync stalls: a persistently mapped buffer split into fenced regions
+//where the context supports buffer storage (GL 4.4), orphaning with glBufferData otherwise
+
+#ifndef STREAM_BUFFER_H
+#define STREAM_BUFFER_H
+
+#include <glad/glad.h>
+
+#include <cstddef>
+
+#include "RenderState.h"
+
+enum StreamMode
+{
+    STREAM_ORPHAN,
+    STREAM_PERSISTENT
+};
+
+//Frames the CPU may run ahead of the GPU before a region has to be waited on
+const int streamRegions{ 3 };
+
+struct StreamBuffer
+{
+    unsigned int buffer{ 0 };
+    StreamMode mode{ STREAM_ORPHAN };
+    std::size_t regionSize{ 0 };
+    int region{ 0 };
+    unsigned char* mapped{ NULL };
+    GLsync fences[streamRegions]{};
+    unsigned long long stalls{ 0 }; //Writes that found their region still in use by the GPU and had to wait
+};
+
+void initStreamBuffer(StreamBuffer& stream, RenderState& renderState, std::size_t regionSize);
+void deleteStreamBuffer(StreamBuffer& stream, RenderState& renderState);
+
+//Copies size bytes into this frame's region, leaves the buffer bound to GL_ARRAY_BUFFER and returns the byte offset they landed at
+std::size_t writeStreamBuffer(StreamBuffer& stream, RenderState& renderState, const void* data, std::size_t size);
+
+//Call once the frame's draws from the stream have been issued, the region is reused after streamRegions frames
+void finishStreamFrame(StreamBuffer& stream);
+
+const char* getStreamModeName(StreamMode mode);
+
+#endif
@@ -0,0 +1,294 @@
+#include "VecEnv.h"
+
+#include <cstring>
+#include <cassert>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SNAKE_VEC_ENV_SSE2
+#include <emmintrin.h>
+#endif
+
+VecEnv::VecEnv(const EnvConfig& config, std::size_t laneCount)
+    : config{ checkEnvConfig(config) }, laneCount{ laneCount }
+{
+    cellCount = static_cast<std::uint32_t>(config.columns) * static_cast<std::uint32_t>(config.rows);
+    wordCount = (cellCount + 63) / 64;
+
+    headRow.resize(laneCount);
+    headColumn.resize(laneCount);
+    heading.resize(laneCount);
+    length.resize(laneCount);
+    bodySize.resize(laneCount);
+    ringHead.resize(laneCount);
+    foodCell.resize(laneCount);
+    episodeSteps.resize(laneCount);
+    laneEpisodes.resize(laneCount);
+    randomGens.resize(laneCount);
+    offBoard.resize(laneCount);
+    bodyRing.resize(laneCount * cellCount);
+    bodyBits.resize(laneCount * wordCount);
+    reset(0);
+}
+
+void VecEnv::bindObservation(const EnvObservation& observation)
+{
+    this->observation = observation;
+}
+
+void VecEnv::reset(std::uint64_t seed)
+{
+    baseSeed = seed;
+    episodes = 0;
+    for (std::size_t lane{ 0 }; lane < laneCount; lane++)
+    {
+        laneEpisodes[lane] = 0;
+        resetLane(lane);
+        writeLane(lane);
+    }
+}
+
+void VecEnv::step(const std::int32_t* actions, float* rewards, std::int32_t* statuses)
+{
+    moveHeads(actions);
+
+    //Same order as advanceGridSnake: the tail leaves before the head arrives
+    for (std::size_t lane{ 0 }; lane < laneCount; lane++)
+    {
+        std::uint32_t* ring{ &bodyRing[lane * cellCount] };
+        std::uint64_t* bits{ &bodyBits[lane * wordCount] };
+        std::uint8_t* board{ observation.board != NULL ? observation.board + (lane * cellCount) : NULL };
+        std::uint32_t cell{ static_cast<std::uint32_t>((headRow[lane] * config.columns) + headColumn[lane]) };
+        float reward{ config.stepReward };
+        EnvStatus status{ ENV_RUNNING };
+        ++episodeSteps[lane];
+
+        bool alive{ offBoard[lane] == 0 };
+        if (alive)
+        {
+            std::uint32_t oldHead{ ring[ringHead[lane]] };
+            if (bodySize[lane] >= length[lane])
+            {
+                std::uint32_t tailSlot{ ringHead[lane] + bodySize[lane] - 1 };
+                std::uint32_t tailCell{ ring[tailSlot < cellCount ? tailSlot : tailSlot - cellCount] };
+                bits[tailCell >> 6] &= ~(std::uint64_t{ 1 } << (tailCell & 63));
+                --bodySize[lane];
+                if (board != NULL)
+                    board[tailCell] = envCellEmpty;
+            }
+
+            alive = !testBody(lane, cell);
+            if (alive)
+            {
+                ringHead[lane] = (ringHead[lane] == 0) ? cellCount - 1 : ringHead[lane] - 1;
+                ring[ringHead[lane]] = cell;
+                bits[cell >> 6] |= std::uint64_t{ 1 } << (cell & 63);
+                ++bodySize[lane];
+                if (board != NULL)
+                {
+                    board[oldHead] = envCellBody;
+                    board[cell] = envCellHead;
+                }
+            }
+        }
+
+        if (!alive)
+        {
+            reward = config.deathReward;
+            status = ENV_TERMINATED;
+        }
+        else
+        {
+            writeHead(lane);
+            if (cell == foodCell[lane])
+            {
+                reward += config.foodReward;
+                if (length[lane] < cellCount)
+                    ++length[lane];
+                placeFood(lane);
+                if (board != NULL && foodCell[lane] != noGridCell)
+                    board[foodCell[lane]] = envCellFood;
+                writeFood(lane);
+            }
+
+            if (bodySize[lane] == cellCount)
+                status = ENV_TERMINATED;
+            else if (config.maxSteps != 0 && episodeSteps[lane] >= config.maxSteps)
+                status = ENV_TRUNCATED;
+        }
+
+        if (status != ENV_RUNNING)
+        {
+            ++laneEpisodes[lane];
+            ++episodes;
+            resetLane(lane);
+            writeLane(lane);
+        }
+        rewards[lane] = reward;
+        statuses[lane] = status;
+    }
+}
+
+//Turns every head and moves it one cell, without looking at the body. Opposite directions differ only in the
+//low bit, a reversal or an unknown action keeps the heading
+void VecEnv::moveHeads(const std::int32_t* actions)
+{
+    std::size_t lane{ 0 };
+#if defined(SNAKE_VEC_ENV_SSE2)
+    //Four games per iteration, the comparisons give all-ones lanes so they add and subtract as -1
+    const __m128i lastDirection{ _mm_set1_epi32(MOVING_RIGHT) };
+    const __m128i ones{ _mm_set1_epi32(1) };
+    const __m128i up{ _mm_set1_epi32(MOVING_UP) };
+    const __m128i down{ _mm_set1_epi32(MOVING_DOWN) };
+    const __m128i left{ _mm_set1_epi32(MOVING_LEFT) };
+    const __m128i right{ _mm_set1_epi32(MOVING_RIGHT) };
+    const __m128i zero{ _mm_setzero_si128() };
+    const __m128i lastRow{ _mm_set1_epi32(config.rows - 1) };
+    const __m128i lastColumn{ _mm_set1_epi32(config.columns - 1) };
+    for (; lane + 4 <= laneCount; lane += 4)
+    {
+        __m128i action{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(actions + lane)) };
+        __m128i current{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(heading.data() + lane)) };
+        __m128i invalid{ _mm_or_si128(_mm_or_si128(_mm_cmplt_epi32(action, zero), _mm_cmpgt_epi32(action, lastDirection)),
+                                      _mm_cmpeq_epi32(_mm_xor_si128(action, current), ones)) };
+        __m128i direction{ _mm_or_si128(_mm_and_si128(invalid, current), _mm_andnot_si128(invalid, action)) };
+
+        __m128i row{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(headRow.data() + lane)) };
+        __m128i column{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(headColumn.data() + lane)) };
+        row = _mm_add_epi32(_mm_sub_epi32(row, _mm_cmpeq_epi32(direction, down)), _mm_cmpeq_epi32(direction, up));
+        column = _mm_add_epi32(_mm_sub_epi32(column, _mm_cmpeq_epi32(direction, left)), _mm_cmpeq_epi32(direction, right));
+        __m128i outside{ _mm_or_si128(_mm_or_si128(_mm_cmplt_epi32(row, zero), _mm_cmpgt_epi32(row, lastRow)),
+                                      _mm_or_si128(_mm_cmplt_epi32(column, zero), _mm_cmpgt_epi32(column, lastColumn))) };
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(heading.data() + lane), direction);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(headRow.data() + lane), row);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(headColumn.data() + lane), column);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(offBoard.data() + lane), outside);
+    }
+#endif
+    for (; lane < laneCount; lane++)
+    {
+        std::int32_t action{ actions[lane] };
+        std::int32_t current{ heading[lane] };
+        bool turn{ action >= MOVING_UP && action <= MOVING_RIGHT && (action ^ current) != 1 };
+        std::int32_t direction{ turn ? action : current };
+        std::int32_t row{ headRow[lane] + (direction == MOVING_DOWN) - (direction == MOVING_UP) };
+        std::int32_t column{ headColumn[lane] + (direction == MOVING_LEFT) - (direction == MOVING_RIGHT) };
+        heading[lane] = direction;
+        headRow[lane] = row;
+        headColumn[lane] = column;
+        offBoard[lane] = (row < 0 || row >= config.rows || column < 0 || column >= config.columns) ? 1 : 0;
+    }
+}
+
+//Starts like GridWorld::reset followed by one piece of food, so a game replays a SnakeEnv one from the same seed
+void VecEnv::resetLane(std::size_t lane)
+{
+    std::memset(&bodyBits[lane * wordCount], 0, wordCount * sizeof(std::uint64_t));
+    std::uint32_t* ring{ &bodyRing[lane * cellCount] };
+    std::uint64_t* bits{ &bodyBits[lane * wordCount] };
+    std::uint32_t columns{ static_cast<std::uint32_t>(config.columns) };
+
+    std::pair<std::uint32_t, std::uint32_t> startCells{ getGridStartCells(config.columns, config.rows) };
+    assert(startCells.second != noGridCell && "board too short for the starting body");
+    headRow[lane] = static_cast<std::int32_t>(startCells.first / columns);
+    headColumn[lane] = static_cast<std::int32_t>(startCells.first % columns);
+    heading[lane] = MOVING_UP;
+    length[lane] = static_cast<std::uint32_t>(1.0f / gridCellSize);
+    ring[0] = startCells.first;
+    ring[1] = startCells.second;
+    ringHead[lane] = 0;
+    bodySize[lane] = 2;
+    bits[startCells.first >> 6] |= std::uint64_t{ 1 } << (startCells.first & 63);
+    bits[startCells.second >> 6] |= std::uint64_t{ 1 } << (startCells.second & 63);
+
+    episodeSteps[lane] = 0;
+    randomGens[lane].seed(baseSeed + lane + (laneEpisodes[lane] * laneCount), RNG_XOSHIRO);
+    placeFood(lane);
+}
+
+//addGridFood for one game: a few random cells, then a uniform pick among the free ones
+void VecEnv::placeFood(std::size_t lane)
+{
+    GameRng& randomGen{ randomGens[lane] };
+    for (int attempt{ 0 }; attempt < foodPlacementRetries; attempt++)
+    {
+        std::uint32_t cell{ randomGen.next() % cellCount };
+        if (!testBody(lane, cell))
+        {
+            foodCell[lane] = cell;
+            return;
+        }
+    }
+
+    const std::uint64_t* bits{ &bodyBits[lane * wordCount] };
+    std::uint64_t lastWordMask{ (cellCount & 63) == 0 ? 0 : ~std::uint64_t{ 0 } << (cellCount & 63) };
+    std::uint32_t freeCount{ 0 };
+    for (std::size_t i{ 0 }; i < wordCount; i++)
+        freeCount += static_cast<std::uint32_t>(countBits(~(bits[i] | (i + 1 == wordCount ? lastWordMask : 0))));
+    if (freeCount == 0)
+    {
+        foodCell[lane] = noGridCell;
+        return;
+    }
+
+    std::uint32_t pick{ randomGen.next() % freeCount };
+    for (std::size_t i{ 0 }; i < wordCount; i++)
+    {
+        std::uint64_t freeBits{ ~(bits[i] | (i + 1 == wordCount ? lastWordMask : 0)) };
+        std::uint32_t wordFree{ static_cast<std::uint32_t>(countBits(freeBits)) };
+        if (pick >= wordFree)
+        {
+            pick -= wordFree;
+            continue;
+        }
+        for (; pick > 0; pick--)
+            freeBits &= freeBits - 1;
+        std::uint32_t bit{ 0 };
+        while (((freeBits >> bit) & 1) == 0)
+            ++bit;
+        foodCell[lane] = static_cast<std::uint32_t>(i * 64) + bit;
+        return;
+    }
+}
+
+void VecEnv::writeLane(std::size_t lane)
+{
+    if (observation.board != NULL)
+    {
+        std::uint8_t* board{ observation.board + (lane * cellCount) };
+        const std::uint32_t* ring{ &bodyRing[lane * cellCount] };
+        std::memset(board, envCellEmpty, cellCount);
+        for (std::uint32_t i{ 0 }; i < bodySize[lane]; i++)
+        {
+            std::uint32_t slot{ ringHead[lane] + i };
+            board[ring[slot < cellCount ? slot : slot - cellCount]] = envCellBody;
+        }
+        board[ring[ringHead[lane]]] = envCellHead;
+        if (foodCell[lane] != noGridCell)
+            board[foodCell[lane]] = envCellFood;
+    }
+    writeHead(lane);
+    writeFood(lane);
+}
+
+void VecEnv::writeHead(std::size_t lane)
+{
+    if (observation.head == NULL)
+        return;
+
+    observation.head[2 * lane] = headRow[lane];
+    observation.head[2 * lane + 1] = headColumn[lane];
+}
+
+void VecEnv::writeFood(std::size_t lane)
+{
+    if (observation.food == NULL || observation.foodSlots == 0)
+        return;
+
+    std::int32_t* food{ observation.food + (2 * lane * observation.foodSlots) };
+    bool placed{ foodCell[lane] != noGridCell };
+    food[0] = placed ? static_cast<std::int32_t>(foodCell[lane] / static_cast<std::uint32_t>(config.columns)) : -1;
+    food[1] = placed ? static_cast<std::int32_t>(foodCell[lane] % static_cast<std::uint32_t>(config.columns)) : -1;
+    for (std::uint32_t slot{ 2 }; slot < 2 * observation.foodSlots; slot++)
+        food[slot] = -1;
+}
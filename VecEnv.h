@@ -0,0 +1,75 @@
+//Many grid mode games stepped together for training. The per-game state lives in one array per field rather than
+//one GridWorld per game, so the move itself (turning, the next head cell, the off-board check) runs four games at a
+//time with SSE2. The occupancy bit tests, body queues and food placement that follow are gathers and stay scalar.
+//A game that ends is restarted in place, and its observation is that of the new episode
+
+#ifndef VEC_ENV_H
+#define VEC_ENV_H
+
+#include <vector>
+#include <cstdint>
+
+#include "SnakeEnv.h"
+
+class VecEnv
+{
+public:
+    //Every game keeps a single piece of food, so config.foodCount is not used. Throws std::invalid_argument for a
+    //board that fails isValidGridBoard
+    VecEnv(const EnvConfig& config, std::size_t laneCount);
+
+    //Buffers hold one game after another: rows * columns board cells, 2 head values and 2 * foodSlots food values
+    //per game. As with SnakeEnv they are only rewritten where the state changed
+    void bindObservation(const EnvObservation& observation);
+
+    //Game i starts from seed + i, its later episodes from seeds laneCount apart
+    void reset(std::uint64_t seed);
+
+    //Advances every game by one move. actions, rewards and statuses hold one entry per game, statuses are
+    //EnvStatus values for the move just made, and a game that ended has already been restarted
+    void step(const std::int32_t* actions, float* rewards, std::int32_t* statuses);
+
+    std::size_t getLaneCount() const { return laneCount; }
+    std::uint32_t getBodySize(std::size_t lane) const { return bodySize[lane]; }
+    std::uint64_t getEpisodes() const { return episodes; }
+
+private:
+    void moveHeads(const std::int32_t* actions);
+    void resetLane(std::size_t lane);
+    void placeFood(std::size_t lane);
+    void writeLane(std::size_t lane);
+    void writeHead(std::size_t lane);
+    void writeFood(std::size_t lane);
+
+    bool testBody(std::size_t lane, std::uint32_t cell) const
+    {
+        return (bodyBits[lane * wordCount + (cell >> 6)] >> (cell & 63)) & 1;
+    }
+
+    EnvConfig config{};
+    std::size_t laneCount{ 0 };
+    std::uint32_t cellCount{ 0 };
+    std::size_t wordCount{ 0 };
+    EnvObservation observation{};
+    std::uint64_t baseSeed{ 0 };
+    std::uint64_t episodes{ 0 };
+
+    //One entry per game
+    std::vector<std::int32_t> headRow{};
+    std::vector<std::int32_t> headColumn{};
+    std::vector<std::int32_t> heading{};
+    std::vector<std::uint32_t> length{};
+    std::vector<std::uint32_t> bodySize{};
+    std::vector<std::uint32_t> ringHead{}; //Slot of the head in the game's body ring
+    std::vector<std::uint32_t> foodCell{}; //noGridCell once the board is full
+    std::vector<std::uint64_t> episodeSteps{};
+    std::vector<std::uint64_t> laneEpisodes{};
+    std::vector<GameRng> randomGens{};
+    std::vector<std::uint32_t> offBoard{}; //Set by moveHeads, non-zero if the head has left the board
+
+    //cellCount body ring slots and wordCount occupancy words per game
+    std::vector<std::uint32_t> bodyRing{};
+    std::vector<std::uint64_t> bodyBits{};
+};
+
+#endif